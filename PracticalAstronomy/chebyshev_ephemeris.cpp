@@ -0,0 +1,296 @@
+#include "chebyshev_ephemeris.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <mutex>
+
+#include "date.h"
+#include "elp82jm.h"
+#include "thread_pool.h"
+#include "vsop87.h"
+
+using namespace PA;
+
+namespace {
+
+using Body = ChebyshevEphemeris::Body;
+
+// Rectangular coordinates given by the theory at the epochs tts
+void ComputeTheory(Body body, const std::vector<double> &tts,
+                   std::vector<double> *p_xyz) {
+  std::size_t size{tts.size()};
+  std::vector<double> lons(size), lats(size), rs(size);
+  if (body == Body::kMoon) {
+    ELP82JM::Compute(tts, lons, lats, rs);
+  } else {
+    VSOP87::Compute(tts, static_cast<VSOP87::Planet>(body), lons, lats, rs);
+  }
+  p_xyz->resize(3 * size);
+  for (std::size_t i = 0; i < size; i++) {
+    (*p_xyz)[3 * i + 0] = rs[i] * std::cos(lats[i]) * std::cos(lons[i]);
+    (*p_xyz)[3 * i + 1] = rs[i] * std::cos(lats[i]) * std::sin(lons[i]);
+    (*p_xyz)[3 * i + 2] = rs[i] * std::sin(lats[i]);
+  }
+}
+
+// Chebyshev coefficients of the segment [tt_begin, tt_begin + days] from the
+// theory at the n Chebyshev nodes, c[0] already halved
+void FitSegment(Body body, double tt_begin, double days, int n, double *c) {
+  std::vector<double> tts(n);
+  for (int k = 0; k < n; k++) {
+    double x{std::cos(M_PI * (k + 0.5) / n)};
+    tts[k] = tt_begin + 0.5 * days * (x + 1.0);
+  }
+  std::vector<double> xyz;
+  ComputeTheory(body, tts, &xyz);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < n; j++) {
+      double sum{0.0};
+      for (int k = 0; k < n; k++) {
+        sum += xyz[3 * k + i] * std::cos(M_PI * j * (k + 0.5) / n);
+      }
+      c[i * n + j] = (j == 0 ? 1.0 : 2.0) * sum / n;
+    }
+  }
+}
+
+// Largest relative position error of the fit, checked between the nodes
+double CheckSegment(Body body, double tt_begin, double days, int n,
+                    const double *c) {
+  constexpr int kCheckPoints{8};
+  std::vector<double> tts(kCheckPoints);
+  for (int k = 0; k < kCheckPoints; k++) {
+    tts[k] = tt_begin + days * (k + 0.5) / kCheckPoints;
+  }
+  std::vector<double> xyz;
+  ComputeTheory(body, tts, &xyz);
+  double max_error{0.0};
+  for (int k = 0; k < kCheckPoints; k++) {
+    double x{2.0 * (k + 0.5) / kCheckPoints - 1.0};
+    double d2{0.0}, r2{0.0};
+    for (int i = 0; i < 3; i++) {
+      // Clenshaw recurrence
+      double b1{0.0}, b2{0.0};
+      for (int j = n - 1; j >= 1; j--) {
+        double b0{c[i * n + j] + 2.0 * x * b1 - b2};
+        b2 = b1;
+        b1 = b0;
+      }
+      double d{c[i * n] + x * b1 - b2 - xyz[3 * k + i]};
+      d2 += d * d;
+      r2 += xyz[3 * k + i] * xyz[3 * k + i];
+    }
+    max_error = std::max(max_error, std::sqrt(d2 / r2));
+  }
+  return max_error;
+}
+
+// Runs f(index) for index in [0, count) on the threads of pool, returning the
+// largest result
+double ParallelMax(ThreadPool &pool, int count,
+                   const std::function<double(int)> &f) {
+  std::mutex mutex;
+  double result{0.0};
+  pool.ParallelFor(count, [&](std::size_t begin, std::size_t end) {
+    double chunk_result{0.0};
+    for (std::size_t i = begin; i < end; i++) {
+      chunk_result = std::max(chunk_result, f(static_cast<int>(i)));
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    result = std::max(result, chunk_result);
+  });
+  return result;
+}
+
+/* File Format */
+
+constexpr char kFileMagic[8]{'P', 'A', 'E', 'P', 'H', 'E', 'M', '\0'};
+constexpr uint32_t kFileVersion{1};
+constexpr uint32_t kFileByteOrder{0x01020304};
+constexpr uint64_t kFileAlignment{64};
+
+struct FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint32_t body_count;
+  uint32_t reserved;
+};
+
+struct FileDirectoryEntry {
+  uint32_t body;
+  int32_t segment_count;
+  int32_t coefficient_count;
+  uint32_t reserved;
+  double tt_begin;
+  double segment_days;
+  double max_error;
+  uint64_t offset;  // Of the coefficients, from the start of the file
+};
+
+static_assert(sizeof(FileHeader) == 24);
+static_assert(sizeof(FileDirectoryEntry) == 48);
+
+uint64_t AlignFileOffset(uint64_t offset) {
+  return (offset + kFileAlignment - 1) / kFileAlignment * kFileAlignment;
+}
+
+}  // namespace
+
+bool ChebyshevEphemeris::Save(const std::string &filename) const {
+  constexpr int kBodyCount{static_cast<int>(Body::kMax)};
+  FileHeader header{};
+  std::memcpy(header.magic, kFileMagic, sizeof(kFileMagic));
+  header.version = kFileVersion;
+  header.byte_order = kFileByteOrder;
+  header.body_count = kBodyCount;
+
+  FileDirectoryEntry directory[kBodyCount]{};
+  uint64_t offset{sizeof(header) + sizeof(directory)};
+  for (int b = 0; b < kBodyCount; b++) {
+    const Segments &segments{segments_[b]};
+    offset = AlignFileOffset(offset);
+    directory[b] = FileDirectoryEntry{
+        .body = static_cast<uint32_t>(b),
+        .segment_count = segments.segment_count,
+        .coefficient_count = segments.coefficient_count,
+        .reserved = 0,
+        .tt_begin = segments.tt_begin,
+        .segment_days = segments.segment_days,
+        .max_error = segments.max_error,
+        .offset = offset,
+    };
+    offset += 3 * sizeof(double) * segments.segment_count *
+              segments.coefficient_count;
+  }
+
+  std::ofstream outfile(filename, std::ios::binary | std::ios::trunc);
+  if (!outfile) return false;
+  outfile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  outfile.write(reinterpret_cast<const char *>(directory), sizeof(directory));
+  for (int b = 0; b < kBodyCount; b++) {
+    const Segments &segments{segments_[b]};
+    static const char padding[kFileAlignment]{};
+    outfile.write(padding, directory[b].offset - outfile.tellp());
+    outfile.write(reinterpret_cast<const char *>(segments.coefficients),
+                  3 * sizeof(double) * segments.segment_count *
+                      segments.coefficient_count);
+  }
+  outfile.close();
+  return static_cast<bool>(outfile);
+}
+
+bool ChebyshevEphemeris::Load(const std::string &filename,
+                              ChebyshevEphemeris *p_ephemeris) {
+  int fd{open(filename.c_str(), O_RDONLY)};
+  if (fd < 0) return false;
+  struct stat st;
+  if (fstat(fd, &st) != 0 ||
+      st.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+    close(fd);
+    return false;
+  }
+  uint64_t size{static_cast<uint64_t>(st.st_size)};
+  void *address{mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0)};
+  close(fd);
+  if (address == MAP_FAILED) return false;
+  std::shared_ptr<const void> mapping{
+      address, [size](const void *p) { munmap(const_cast<void *>(p), size); }};
+
+  const char *base{static_cast<const char *>(address)};
+  const FileHeader *header{reinterpret_cast<const FileHeader *>(base)};
+  constexpr int kBodyCount{static_cast<int>(Body::kMax)};
+  if (std::memcmp(header->magic, kFileMagic, sizeof(kFileMagic)) != 0 ||
+      header->version != kFileVersion ||
+      header->byte_order != kFileByteOrder ||
+      header->body_count != kBodyCount ||
+      size < sizeof(FileHeader) + kBodyCount * sizeof(FileDirectoryEntry)) {
+    return false;
+  }
+
+  ChebyshevEphemeris ephemeris;
+  const FileDirectoryEntry *directory{
+      reinterpret_cast<const FileDirectoryEntry *>(base + sizeof(FileHeader))};
+  for (int b = 0; b < kBodyCount; b++) {
+    const FileDirectoryEntry &entry{directory[b]};
+    uint64_t bytes{3 * sizeof(double) *
+                   static_cast<uint64_t>(entry.segment_count) *
+                   static_cast<uint64_t>(entry.coefficient_count)};
+    if (entry.body != static_cast<uint32_t>(b) || entry.segment_count < 1 ||
+        entry.coefficient_count < 1 ||
+        entry.coefficient_count > kMaxCoefficientCount ||
+        !(entry.segment_days > 0.0) || entry.offset % kFileAlignment != 0 ||
+        entry.offset > size || bytes > size - entry.offset) {
+      return false;
+    }
+    ephemeris.segments_[b] = Segments{
+        .tt_begin = entry.tt_begin,
+        .segment_days = entry.segment_days,
+        .segment_count = entry.segment_count,
+        .coefficient_count = entry.coefficient_count,
+        .max_error = entry.max_error,
+        .coefficients = reinterpret_cast<const double *>(base + entry.offset),
+    };
+  }
+  ephemeris.mapping_ = std::move(mapping);
+  *p_ephemeris = std::move(ephemeris);
+  return true;
+}
+
+ChebyshevEphemeris ChebyshevEphemeris::Build(double tt_begin, double tt_end,
+                                             double tolerance,
+                                             int thread_count) {
+  ThreadPool pool{ThreadPool::Options{thread_count, false}};
+  ChebyshevEphemeris ephemeris;
+  for (int b = 0; b < static_cast<int>(Body::kMax); b++) {
+    Body body{static_cast<Body>(b)};
+    double days{kSegmentDays[b]};
+    int count{std::max(1, static_cast<int>(std::ceil((tt_end - tt_begin) / days)))};
+    std::vector<double> &storage{ephemeris.storage_[b]};
+
+    // Smallest number of coefficients meeting the tolerance on a few probe
+    // segments, then on all of them
+    int probes[]{0, count / 4, count / 2, 3 * count / 4, count - 1};
+    int n{kMinCoefficientCount};
+    double max_error{0.0};
+    while (true) {
+      std::vector<double> c(3 * n);
+      double probe_error{0.0};
+      for (int index : probes) {
+        double tt{tt_begin + index * days};
+        FitSegment(body, tt, days, n, c.data());
+        probe_error = std::max(probe_error, CheckSegment(body, tt, days, n, c.data()));
+      }
+      if (probe_error <= tolerance || n >= kMaxCoefficientCount) {
+        storage.assign(3 * n * count, 0.0);
+        max_error = ParallelMax(pool, count, [&](int index) {
+          double tt{tt_begin + index * days};
+          double *c{storage.data() + 3 * n * index};
+          FitSegment(body, tt, days, n, c);
+          return CheckSegment(body, tt, days, n, c);
+        });
+        if (max_error <= tolerance || n >= kMaxCoefficientCount) break;
+      }
+      n = std::min(n + 2, kMaxCoefficientCount);
+    }
+
+    ephemeris.segments_[b] = Segments{
+        .tt_begin = tt_begin,
+        .segment_days = days,
+        .segment_count = count,
+        .coefficient_count = n,
+        .max_error = max_error,
+        .coefficients = storage.data(),
+    };
+  }
+  return ephemeris;
+}
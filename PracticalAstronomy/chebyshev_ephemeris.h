@@ -0,0 +1,222 @@
+#ifndef CHEBYSHEV_EPHEMERIS_H_
+#define CHEBYSHEV_EPHEMERIS_H_
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "radian.h"
+
+namespace PA {
+
+// Chebyshev ephemeris, in the style of the JPL DE files
+// - The positions given by VSOP87 (heliocentric planets) and ELP82JM
+//   (geocentric Moon) are fitted over fixed intervals with Chebyshev
+//   polynomials of the rectangular coordinates, in the frames and units of
+//   these theories (AU for the planets, km for the Moon)
+// - Evaluating a position then takes three Clenshaw recurrences instead of
+//   the full series
+// - References:
+//   - https://ssd.jpl.nasa.gov/planets/eph_export.html
+//   - Press et al., Numerical Recipes, 3rd Edition, Section 5.8
+class ChebyshevEphemeris {
+ public:
+  enum class Body {
+    kMercury,
+    kVenus,
+    kEarth,
+    kMars,
+    kJupiter,
+    kSaturn,
+    kUranus,
+    kNeptune,
+    kMoon,
+    kMax,
+  };
+
+  // Coefficients of a body: segment_count consecutive intervals of
+  // segment_days from tt_begin, each with coefficient_count coefficients for
+  // each of x, y and z
+  // - max_error: Largest |position error| / |position| found when checking the
+  //   fit against the theory
+  struct Segments {
+    double tt_begin;
+    double segment_days;
+    int segment_count;
+    int coefficient_count;
+    double max_error;
+    const double *coefficients;
+  };
+
+  // Interval lengths (days), following JPL DE430
+  static constexpr double kSegmentDays[]{
+      [static_cast<int>(Body::kMercury)] = 8.0,
+      [static_cast<int>(Body::kVenus)] = 16.0,
+      [static_cast<int>(Body::kEarth)] = 16.0,
+      [static_cast<int>(Body::kMars)] = 32.0,
+      [static_cast<int>(Body::kJupiter)] = 32.0,
+      [static_cast<int>(Body::kSaturn)] = 32.0,
+      [static_cast<int>(Body::kUranus)] = 32.0,
+      [static_cast<int>(Body::kNeptune)] = 32.0,
+      [static_cast<int>(Body::kMoon)] = 4.0,
+  };
+  static constexpr int kMinCoefficientCount{6};
+  static constexpr int kMaxCoefficientCount{32};
+
+  ChebyshevEphemeris() noexcept {}
+  ChebyshevEphemeris(const ChebyshevEphemeris &) = delete;
+  ChebyshevEphemeris &operator=(const ChebyshevEphemeris &) = delete;
+  ChebyshevEphemeris(ChebyshevEphemeris &&) = default;
+  ChebyshevEphemeris &operator=(ChebyshevEphemeris &&) = default;
+
+  // Fits all bodies over [tt_begin, tt_end], choosing for each body the
+  // smallest number of coefficients that meets the (relative) tolerance
+  // - Segments are fitted in parallel on a ThreadPool of thread_count threads
+  //   (0: one per hardware thread)
+  static ChebyshevEphemeris Build(double tt_begin, double tt_end,
+                                  double tolerance = 1.0e-10,
+                                  int thread_count = 0);
+
+  // Persistent file
+  // - Format (version 1, native byte order): A header, a directory of the
+  //   bodies, then the coefficients of each body at 64-byte aligned offsets
+  //   (see chebyshev_ephemeris.cpp)
+  // - Load() maps the file read-only and evaluates the coefficients in place,
+  //   so that processes loading the same file share one page-cache copy
+  // - Both return false on failure (I/O error, or not a valid file)
+  bool Save(const std::string &filename) const;
+  static bool Load(const std::string &filename,
+                   ChebyshevEphemeris *p_ephemeris);
+
+  // Same outputs as VSOP87::Compute() and ELP82JM::Compute(), except that the
+  // longitude is in [0, 2 pi)
+  // - Returns false if tt is not covered
+  inline bool Compute(Body body, double tt, double *p_longitude,
+                      double *p_latitude,
+                      double *p_radius_vector) const noexcept;
+
+  // Same, with the rates (radians or units per day) from the derivatives of
+  // the Chebyshev polynomials
+  inline bool ComputeWithRates(Body body, double tt, double *p_longitude,
+                               double *p_latitude, double *p_radius_vector,
+                               double *p_longitude_rate,
+                               double *p_latitude_rate,
+                               double *p_radius_vector_rate) const noexcept;
+
+  const Segments &GetSegments(Body body) const noexcept {
+    return segments_[static_cast<int>(body)];
+  }
+
+ private:
+  static inline double Clenshaw(const double *c, int n, double x) noexcept;
+  // Value and derivative w.r.t. x, using d T_k / dx = k U_(k-1)
+  static inline void ClenshawWithDerivative(const double *c, int n, double x,
+                                            double *p_value,
+                                            double *p_derivative) noexcept;
+
+  Segments segments_[static_cast<int>(Body::kMax)]{};
+  // Coefficients owned by a built ephemeris, or the mapping of a loaded one
+  std::vector<double> storage_[static_cast<int>(Body::kMax)];
+  std::shared_ptr<const void> mapping_;
+};
+
+inline double ChebyshevEphemeris::Clenshaw(const double *c, int n,
+                                           double x) noexcept {
+  double b1{0.0}, b2{0.0};
+  for (int k = n - 1; k >= 1; k--) {
+    double b0{c[k] + 2.0 * x * b1 - b2};
+    b2 = b1;
+    b1 = b0;
+  }
+  return c[0] + x * b1 - b2;
+}
+
+inline void ChebyshevEphemeris::ClenshawWithDerivative(
+    const double *c, int n, double x, double *p_value,
+    double *p_derivative) noexcept {
+  // T_k and U_k by their common recurrence P_(k+1) = 2 x P_k - P_(k-1)
+  double t0{1.0}, t1{x}, u0{1.0}, u1{2.0 * x};
+  double value{c[0] + (n > 1 ? c[1] * x : 0.0)};
+  double derivative{n > 1 ? c[1] : 0.0};
+  for (int k = 2; k < n; k++) {
+    double t2{2.0 * x * t1 - t0};
+    value += c[k] * t2;
+    derivative += k * c[k] * u1;
+    double u2{2.0 * x * u1 - u0};
+    t0 = t1;
+    t1 = t2;
+    u0 = u1;
+    u1 = u2;
+  }
+  *p_value = value;
+  *p_derivative = derivative;
+}
+
+inline bool ChebyshevEphemeris::Compute(Body body, double tt,
+                                        double *p_longitude,
+                                        double *p_latitude,
+                                        double *p_radius_vector) const
+    noexcept {
+  const Segments &segments{segments_[static_cast<int>(body)]};
+  double offset{(tt - segments.tt_begin) / segments.segment_days};
+  if (!(offset >= 0.0 && offset <= segments.segment_count)) return false;
+  int index{static_cast<int>(offset)};
+  if (index == segments.segment_count) index--;
+
+  int n{segments.coefficient_count};
+  const double *c{segments.coefficients + 3 * n * index};
+  double x{2.0 * (offset - index) - 1.0};
+  double px{Clenshaw(c, n, x)};
+  double py{Clenshaw(c + n, n, x)};
+  double pz{Clenshaw(c + 2 * n, n, x)};
+
+  double rho{std::hypot(px, py)};
+  if (p_longitude) *p_longitude = RadUnwind(std::atan2(py, px));
+  if (p_latitude) *p_latitude = std::atan2(pz, rho);
+  if (p_radius_vector) *p_radius_vector = std::hypot(rho, pz);
+  return true;
+}
+
+inline bool ChebyshevEphemeris::ComputeWithRates(
+    Body body, double tt, double *p_longitude, double *p_latitude,
+    double *p_radius_vector, double *p_longitude_rate, double *p_latitude_rate,
+    double *p_radius_vector_rate) const noexcept {
+  const Segments &segments{segments_[static_cast<int>(body)]};
+  double offset{(tt - segments.tt_begin) / segments.segment_days};
+  if (!(offset >= 0.0 && offset <= segments.segment_count)) return false;
+  int index{static_cast<int>(offset)};
+  if (index == segments.segment_count) index--;
+
+  int n{segments.coefficient_count};
+  const double *c{segments.coefficients + 3 * n * index};
+  double x{2.0 * (offset - index) - 1.0};
+  double p[3], v[3];
+  for (int i = 0; i < 3; i++) {
+    ClenshawWithDerivative(c + i * n, n, x, &p[i], &v[i]);
+    // dx/dtt = 2 / segment_days
+    v[i] *= 2.0 / segments.segment_days;
+  }
+
+  double rho2{p[0] * p[0] + p[1] * p[1]};
+  double rho{std::sqrt(rho2)};
+  double r{std::hypot(rho, p[2])};
+  double rho_rate{(p[0] * v[0] + p[1] * v[1]) / rho};
+  if (p_longitude) *p_longitude = RadUnwind(std::atan2(p[1], p[0]));
+  if (p_latitude) *p_latitude = std::atan2(p[2], rho);
+  if (p_radius_vector) *p_radius_vector = r;
+  if (p_longitude_rate) {
+    *p_longitude_rate = (p[0] * v[1] - p[1] * v[0]) / rho2;
+  }
+  if (p_latitude_rate) {
+    *p_latitude_rate = (rho * v[2] - p[2] * rho_rate) / (r * r);
+  }
+  if (p_radius_vector_rate) {
+    *p_radius_vector_rate = (rho * rho_rate + p[2] * v[2]) / r;
+  }
+  return true;
+}
+
+}  // namespace PA
+
+#endif  // CHEBYSHEV_EPHEMERIS_H_
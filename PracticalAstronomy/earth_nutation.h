@@ -1,7 +1,14 @@
 #ifndef EARTH_NUTATION_H_
 #define EARTH_NUTATION_H_
 
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <iterator>
+#include <span>
+
 #include "radian.h"
+#include "simd.h"
 #include "utils.h"
 
 namespace PA {
@@ -14,9 +21,450 @@ class EarthNutation {
                                                double *p_obliquity) noexcept;
   static constexpr void ComputeNutationIAU2000B(double tt, double *p_longitude,
                                                 double *p_obliquity) noexcept;
+  // Batches over the epochs tts, an epoch per lane of the vectors of the host
+  // ISA (see SIMD::ComputeNutation() and simd_dispatch.h)
+  // - Outputs are skipped when their span is empty, otherwise they must have
+  //   the size of tts
+  static inline void ComputeNutationIAU1980(std::span<const double> tts,
+                                            std::span<double> longitudes,
+                                            std::span<double> obliquities);
+  static inline void ComputeNutationIAU2000B(std::span<const double> tts,
+                                             std::span<double> longitudes,
+                                             std::span<double> obliquities);
+
+  // IAU 2000A: The luni-solar and planetary series of the IERS Conventions,
+  // sorted by decreasing amplitude and truncated to an accuracy target, with
+  // the same scalar and batch evaluations as IAU 2000B
+  // - Tables generated by Utilities/main.cpp (iau2000a_internal.dat), see
+  //   kTermsIAU2000A for their source
+  // - Accuracy: Bound of the dropped terms over 1900-2100
+  enum class Accuracy {
+    kFull,
+    k0_1MilliArcSec,
+    k1MilliArcSec,
+    k10MilliArcSec,
+    kMax,
+  };
+  static inline void ComputeNutationIAU2000A(
+      double tt, double *p_longitude, double *p_obliquity,
+      Accuracy accuracy = Accuracy::kFull) noexcept;
+  static inline void ComputeNutationIAU2000A(
+      std::span<const double> tts, std::span<double> longitudes,
+      std::span<double> obliquities, Accuracy accuracy = Accuracy::kFull);
+  // Leading terms of IAU 2000A evaluated for the accuracy
+  static inline int GetTermCountIAU2000A(Accuracy accuracy) noexcept;
+
+  /* Tables
+   * - Shared by the scalar and the vector evaluations
+   */
+
+  // Largest |multiplier| of l, l', F, D and Omega in the periodic terms of
+  // IAU 1980 and IAU 2000B
+  static constexpr int kMaxMultiple{4};
+  static constexpr int kArgumentCount{5};
+
+  // Periodic terms, structure-of-arrays: Multipliers of the A fundamental
+  // arguments, and the coefficients of
+  //   dpsi = (psi_sin + psi_t_sin t) sin(arg)
+  //          + (psi_cos + psi_t_cos t) cos(arg)
+  //   deps = (eps_cos + eps_t_cos t) cos(arg)
+  //          + (eps_sin + eps_t_sin t) sin(arg)
+  // in units of 1 / divisor radians
+  template <int N, int A = kArgumentCount>
+  struct Terms {
+    double divisor;
+    // l (mean anomaly of the Moon), l' (of the Sun), F (Moon's argument of
+    // latitude), D (mean elongation of the Moon from the Sun), Omega
+    // (longitude of the ascending node of the Moon), then the planetary
+    // arguments of kArgumentsIAU2000A
+    alignas(64) int multipliers[A][N];
+    alignas(64) double psi_sin[N];
+    alignas(64) double psi_t_sin[N];
+    alignas(64) double psi_cos[N];
+    alignas(64) double psi_t_cos[N];
+    alignas(64) double eps_cos[N];
+    alignas(64) double eps_t_cos[N];
+    alignas(64) double eps_sin[N];
+    alignas(64) double eps_t_sin[N];
+  };
+
+  // Leading terms of a table to keep, so that the dropped ones sum to at most
+  // tolerance (radians) in either output over |t| <= 1 (1900-2100), and the
+  // largest |multiplier| of each argument in them (the multiples to compute)
+  template <int A>
+  struct Truncation {
+    int term_count;
+    int max_multiples[A];
+  };
+  template <int N, int A>
+  static constexpr Truncation<A> GetTruncation(const Terms<N, A> &terms,
+                                               double tolerance) noexcept;
+
+  // Terms as indices into the multiples of the arguments, laid out as
+  // sin_kx[a * (2 kMax + 1) + k + kMax] (see sin_cos_multiples()): kSlotCount
+  // per term, of its nonzero multipliers, then of a multiple 0 (sin 0, cos 1)
+  // - The sums run the same angle additions for every term, without branches
+  //   on the multipliers (most are zero in IAU 2000A)
+  template <int N, int kSlotCount>
+  struct TermIndices {
+    alignas(64) int slots[kSlotCount][N];
+  };
+  template <const auto &kTerms, int kMax>
+  static constexpr auto GetTermIndices() noexcept;
+  template <const auto &kTerms, int kMax>
+  static constexpr auto kTermIndices{GetTermIndices<kTerms, kMax>()};
+
+  // IAU 1980
+  // - Fundamental arguments l, l', F, D and Omega: Coefficients of the powers
+  //   of t, in Julian centuries from J2000
+  static constexpr double kArgumentsIAU1980[kArgumentCount][4]{
+      {134_deg + 57_arcmin + 46.733_arcsec,
+       1325 * 360_deg + 198_deg + 52_arcmin + 2.633_arcsec, 31.310_arcsec,
+       0.064_arcsec},
+      {357_deg + 31_arcmin + 39.804_arcsec,
+       99 * 360_deg + 359_deg + 3_arcmin + 1.224_arcsec, -0.577_arcsec,
+       -0.012_arcsec},
+      {93_deg + 16_arcmin + 18.877_arcsec,
+       1342 * 360_deg + 82_deg + 1_arcmin + 3.137_arcsec, -13.257_arcsec,
+       0.011_arcsec},
+      {297_deg + 51_arcmin + 1.307_arcsec,
+       1236 * 360_deg + 307_deg + 6_arcmin + 41.328_arcsec, -6.891_arcsec,
+       0.019_arcsec},
+      {125_deg + 2_arcmin + 40.280_arcsec,
+       -(5 * 360_deg + 134_deg + 8_arcmin + 10.539_arcsec), 7.455_arcsec,
+       0.008_arcsec},
+  };
+  static constexpr Terms<106> kTermsIAU1980{
+      .divisor = 10000.0,
+      .multipliers = {
+          // l
+          {0, 0, 0, 0, 0, 1, 0, 0, 1, 0, -1, 0, -1, 1, 0, -1, -1, 1, -2, -2, 0,
+           2, 2, 1, 0, 0, -1, 0, 0, -1, 0, 1, 0, 2, -1, 1, 0, 0, 1, 0, -2, 0, 2,
+           1, 1, 0, 0, 2, 1, 1, 0, 0, 1, 2, 0, 1, 1, -1, 0, 1, 3, -2, 1, -1, 1,
+           -1, 0, -2, 2, 3, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 2, 0, 0, -2, 2,
+           0, 0, 0, 0, 1, 3, -2, -1, 0, 0, -1, 2, 2, 2, 2, 1, -1, -1, 0},
+          // l'
+          {0, 0, 0, 0, -1, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+           0, 0, 0, 0, 0, 2, 2, 0, 1, 0, -1, 0, 0, 0, -1, 0, 1, 1, 0, 0, 0, 0,
+           0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 1, 1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
+           0, -2, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+           -1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, -1, 0, -1, 1},
+          // F
+          {0, 2, 2, 0, 0, 0, 2, 2, 2, 2, 0, 2, 2, 0, 0, 2, 0, 2, 0, 2, 2, 2, 0,
+           2, 2, 2, 2, 0, 2, 0, 0, 0, 0, -2, 2, 2, 2, 2, 0, 2, 0, 0, 2, 0, 2, 0,
+           2, 2, 0, 0, 0, 0, -2, 0, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 0, 0,
+           0, 2, 2, 0, 2, 0, 0, 2, -2, -2, -2, 2, 0, 0, 2, 2, 2, 2, 2, -2, 4, 0,
+           2, 2, 2, 0, -2, 2, 4, 0, 0, 2, -2, 0, 0, 0, 0},
+          // D
+          {0, -2, 0, 0, 0, 0, -2, 0, 0, -2, 2, -2, 0, 0, 2, 2, 0, 0, 2, 0, 2, 0,
+           0, -2, 0, -2, 0, 0, -2, 2, 0, -2, 0, 0, 2, 2, 0, 2, -2, 0, 2, 2, -2,
+           2, -2, -2, -2, 0, 0, -1, 1, -2, 0, -2, -2, 0, -1, 2, 2, 0, 0, 0, 0,
+           4, 0, -2, -2, 0, 0, 0, 0, 1, 2, 2, -2, 2, -2, 2, 2, -2, -2, -4, -4,
+           4, -1, 4, 2, 0, 0, -2, 0, -2, -2, 2, 0, 2, 0, 0, -2, 2, -2, 0, -2, 1,
+           2, 1},
+          // Omega
+          {1, 2, 2, 2, 0, 0, 2, 1, 2, 2, 0, 1, 2, 1, 0, 2, 1, 1, 0, 1, 2, 2, 0,
+           2, 0, 0, 1, 0, 2, 1, 1, 1, 1, 0, 1, 2, 2, 1, 0, 2, 1, 1, 2, 0, 1, 1,
+           1, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 2, 2, 2, 2, 2, 0, 2, 2, 1, 1, 1, 1,
+           0, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 1, 1, 2, 2, 2,
+           2, 2, 2, 1, 1, 2, 0, 0, 1, 1, 0, 1, 1, 0},
+      },
+      .psi_sin = {
+          -171996.0_arcsec, -13187.0_arcsec, -2274.0_arcsec, 2062.0_arcsec,
+          -1426.0_arcsec, 712.0_arcsec, -517.0_arcsec, -386.0_arcsec,
+          -301.0_arcsec, 217.0_arcsec, 158.0_arcsec, 129.0_arcsec, 123.0_arcsec,
+          63.0_arcsec, 63.0_arcsec, -59.0_arcsec, -58.0_arcsec, -51.0_arcsec,
+          -48.0_arcsec, 46.0_arcsec, -38.0_arcsec, -31.0_arcsec, 29.0_arcsec,
+          29.0_arcsec, 26.0_arcsec, -22.0_arcsec, 21.0_arcsec, 17.0_arcsec,
+          -16.0_arcsec, 16.0_arcsec, -15.0_arcsec, -13.0_arcsec, -12.0_arcsec,
+          11.0_arcsec, -10.0_arcsec, -8.0_arcsec, -7.0_arcsec, -7.0_arcsec,
+          -7.0_arcsec, 7.0_arcsec, -6.0_arcsec, -6.0_arcsec, 6.0_arcsec,
+          6.0_arcsec, 6.0_arcsec, -5.0_arcsec, -5.0_arcsec, -5.0_arcsec,
+          5.0_arcsec, -4.0_arcsec, -4.0_arcsec, -4.0_arcsec, 4.0_arcsec,
+          4.0_arcsec, 4.0_arcsec, -3.0_arcsec, -3.0_arcsec, -3.0_arcsec,
+          -3.0_arcsec, -3.0_arcsec, -3.0_arcsec, -3.0_arcsec, 3.0_arcsec,
+          -2.0_arcsec, -2.0_arcsec, -2.0_arcsec, -2.0_arcsec, -2.0_arcsec,
+          2.0_arcsec, 2.0_arcsec, 2.0_arcsec, 2.0_arcsec, -1.0_arcsec,
+          -1.0_arcsec, -1.0_arcsec, -1.0_arcsec, -1.0_arcsec, -1.0_arcsec,
+          -1.0_arcsec, -1.0_arcsec, -1.0_arcsec, -1.0_arcsec, -1.0_arcsec,
+          -1.0_arcsec, -1.0_arcsec, -1.0_arcsec, -1.0_arcsec, -1.0_arcsec,
+          -1.0_arcsec, 1.0_arcsec, 1.0_arcsec, 1.0_arcsec, 1.0_arcsec,
+          1.0_arcsec, 1.0_arcsec, 1.0_arcsec, 1.0_arcsec, 1.0_arcsec,
+          1.0_arcsec, 1.0_arcsec, 1.0_arcsec, 1.0_arcsec, 1.0_arcsec,
+          1.0_arcsec, 1.0_arcsec, 1.0_arcsec},
+      .psi_t_sin = {
+          -174.2_arcsec, -1.6_arcsec, -0.2_arcsec, 0.2_arcsec, 3.4_arcsec,
+          0.1_arcsec, 1.2_arcsec, -0.4_arcsec, 0.0_arcsec, -0.5_arcsec,
+          0.0_arcsec, 0.1_arcsec, 0.0_arcsec, 0.1_arcsec, 0.0_arcsec,
+          0.0_arcsec, -0.1_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, -0.1_arcsec, 0.1_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec},
+      .psi_cos = {},
+      .psi_t_cos = {},
+      .eps_cos = {
+          92025.0_arcsec, 5736.0_arcsec, 977.0_arcsec, -895.0_arcsec,
+          54.0_arcsec, -7.0_arcsec, 224.0_arcsec, 200.0_arcsec, 129.0_arcsec,
+          -95.0_arcsec, -1.0_arcsec, -70.0_arcsec, -53.0_arcsec, -33.0_arcsec,
+          -2.0_arcsec, 26.0_arcsec, 32.0_arcsec, 27.0_arcsec, 1.0_arcsec,
+          -24.0_arcsec, 16.0_arcsec, 13.0_arcsec, -1.0_arcsec, -12.0_arcsec,
+          -1.0_arcsec, 0.0_arcsec, -10.0_arcsec, 0.0_arcsec, 7.0_arcsec,
+          -8.0_arcsec, 9.0_arcsec, 7.0_arcsec, 6.0_arcsec, 0.0_arcsec,
+          5.0_arcsec, 3.0_arcsec, 3.0_arcsec, 3.0_arcsec, 0.0_arcsec,
+          -3.0_arcsec, 3.0_arcsec, 3.0_arcsec, -3.0_arcsec, 0.0_arcsec,
+          -3.0_arcsec, 3.0_arcsec, 3.0_arcsec, 3.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, -2.0_arcsec,
+          -2.0_arcsec, 0.0_arcsec, 0.0_arcsec, 1.0_arcsec, 1.0_arcsec,
+          1.0_arcsec, 1.0_arcsec, 1.0_arcsec, 0.0_arcsec, 1.0_arcsec,
+          1.0_arcsec, 1.0_arcsec, 1.0_arcsec, 1.0_arcsec, -1.0_arcsec,
+          0.0_arcsec, -1.0_arcsec, -1.0_arcsec, 0.0_arcsec, 1.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, -1.0_arcsec, 0.0_arcsec, -1.0_arcsec,
+          -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec},
+      .eps_t_cos = {
+          8.9_arcsec, -3.1_arcsec, -0.5_arcsec, 0.5_arcsec, -0.1_arcsec,
+          0.0_arcsec, -0.6_arcsec, 0.0_arcsec, -0.1_arcsec, 0.3_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec,
+          0.0_arcsec},
+      .eps_sin = {},
+      .eps_t_sin = {},
+  };
+
+  // IAU 2000B
+  static constexpr double kArgumentsIAU2000B[kArgumentCount][5]{
+      {+485868.249036_arcsec, +1717915923.2178_arcsec, +31.8792_arcsec,
+       +0.051635_arcsec, -0.00024470_arcsec},
+      {+1287104.79305_arcsec, +129596581.0481_arcsec, -0.5532_arcsec,
+       +0.000136_arcsec, -0.00001149_arcsec},
+      {+335779.526232_arcsec, +1739527262.8478_arcsec, -12.7512_arcsec,
+       -0.001037_arcsec, +0.00000417_arcsec},
+      {+1072260.70369_arcsec, +1602961601.2090_arcsec, -6.3706_arcsec,
+       +0.006593_arcsec, -0.00003169_arcsec},
+      {+450160.398036_arcsec, -6962890.5431_arcsec, +7.4722_arcsec,
+       +0.007702_arcsec, -0.00005939_arcsec},
+  };
+  static constexpr Terms<77> kTermsIAU2000B{
+      .divisor = 10000000.0,
+      .multipliers = {
+          // l
+          {0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, -1, -1, 1, -1, -1, 1, -2, 0, 0, 0,
+           -2, 2, 1, -1, 2, 0, 0, -1, 0, 0, 1, 0, -1, 0, 1, -2, 0, 0, 0, 0, 1,
+           2, -2, 2, 0, 0, -1, 2, 1, 0, 1, -2, 3, 0, 1, 0, -1, -1, 0, -2, 1, 2,
+           -1, 1, 1, -1, 1, -1, 0, -1, -1, 0, 1, -2, -1, 1},
+          // l'
+          {0, 0, 0, 0, 1, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0,
+           0, 0, 0, 0, 0, 1, 0, 2, 0, 0, -1, 0, 2, 0, 0, 1, 0, -1, 0, 0, 0, 0,
+           0, -1, 0, -1, 0, 0, 1, -1, 0, 0, -1, -1, 0, -1, 0, -1, 0, 1, 0, 1, 1,
+           0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 1},
+          // F
+          {0, 2, 2, 0, 0, 2, 0, 2, 2, 2, 2, 2, 0, 0, 0, 2, 2, 2, 0, 2, 2, 0, 2,
+           2, 2, 0, 2, 0, 0, 2, -2, 0, 0, 2, 0, 2, 2, 2, 2, 2, 0, 2, 2, 0, 2, 2,
+           0, 0, 0, 0, 2, 0, 2, 2, 0, 2, 0, 2, 2, 2, 0, 2, 0, 0, 0, 2, 2, 0, 0,
+           2, 2, 0, 2, 2, 2, 0, 2},
+          // D
+          {0, -2, 0, 0, 0, -2, 0, 0, 0, -2, -2, 0, 2, 0, 0, 2, 0, 0, 2, 2, -2,
+           2, 0, -2, 0, 0, 0, 0, 2, -2, 2, -2, 0, 2, 0, 2, 0, 0, 2, 0, 2, -2,
+           -2, 2, 0, -2, -2, 2, -2, 2, -2, 0, 0, 0, 2, 0, 1, 2, 0, 2, 0, 0, 0,
+           1, 0, 0, -2, 0, 1, 1, 4, 1, -2, 2, 2, 0, -2},
+          // Omega
+          {1, 2, 2, 2, 0, 2, 0, 1, 2, 2, 1, 2, 0, 1, 1, 2, 1, 1, 0, 2, 2, 0, 2,
+           2, 1, 0, 0, 1, 1, 2, 0, 1, 1, 1, 0, 2, 0, 2, 1, 2, 1, 1, 2, 1, 1, 1,
+           1, 0, 1, 0, 1, 0, 2, 2, 0, 2, 0, 2, 0, 2, 1, 2, 1, 0, 0, 0, 1, 2, 0,
+           2, 2, 1, 1, 1, 2, 2, 2},
+      },
+      .psi_sin = {
+          -172064161_arcsec, -13170906_arcsec, -2276413_arcsec, 2074554_arcsec,
+          1475877_arcsec, -516821_arcsec, 711159_arcsec, -387298_arcsec,
+          -301461_arcsec, 215829_arcsec, 128227_arcsec, 123457_arcsec,
+          156994_arcsec, 63110_arcsec, -57976_arcsec, -59641_arcsec,
+          -51613_arcsec, 45893_arcsec, 63384_arcsec, -38571_arcsec,
+          32481_arcsec, -47722_arcsec, -31046_arcsec, 28593_arcsec,
+          20441_arcsec, 29243_arcsec, 25887_arcsec, -14053_arcsec, 15164_arcsec,
+          -15794_arcsec, 21783_arcsec, -12873_arcsec, -12654_arcsec,
+          -10204_arcsec, 16707_arcsec, -7691_arcsec, -11024_arcsec, 7566_arcsec,
+          -6637_arcsec, -7141_arcsec, -6302_arcsec, 5800_arcsec, 6443_arcsec,
+          -5774_arcsec, -5350_arcsec, -4752_arcsec, -4940_arcsec, 7350_arcsec,
+          4065_arcsec, 6579_arcsec, 3579_arcsec, 4725_arcsec, -3075_arcsec,
+          -2904_arcsec, 4348_arcsec, -2878_arcsec, -4230_arcsec, -2819_arcsec,
+          -4056_arcsec, -2647_arcsec, -2294_arcsec, 2481_arcsec, 2179_arcsec,
+          3276_arcsec, -3389_arcsec, 3339_arcsec, -1987_arcsec, -1981_arcsec,
+          4026_arcsec, 1660_arcsec, -1521_arcsec, 1314_arcsec, -1283_arcsec,
+          -1331_arcsec, 1383_arcsec, 1405_arcsec, 1290_arcsec},
+      .psi_t_sin = {
+          -174666_arcsec, -1675_arcsec, -234_arcsec, 207_arcsec, -3633_arcsec,
+          1226_arcsec, 73_arcsec, -367_arcsec, -36_arcsec, -494_arcsec,
+          137_arcsec, 11_arcsec, 10_arcsec, 63_arcsec, -63_arcsec, -11_arcsec,
+          -42_arcsec, 50_arcsec, 11_arcsec, -1_arcsec, 0_arcsec, 0_arcsec,
+          -1_arcsec, 0_arcsec, 21_arcsec, 0_arcsec, 0_arcsec, -25_arcsec,
+          10_arcsec, 72_arcsec, 0_arcsec, -10_arcsec, 11_arcsec, 0_arcsec,
+          -85_arcsec, 0_arcsec, 0_arcsec, -21_arcsec, -11_arcsec, 21_arcsec,
+          -11_arcsec, 10_arcsec, 0_arcsec, -11_arcsec, 0_arcsec, -11_arcsec,
+          -11_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec,
+          0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec,
+          0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec,
+          0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec,
+          0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec},
+      .psi_cos = {
+          33386_arcsec, -13696_arcsec, 2796_arcsec, -698_arcsec, 11817_arcsec,
+          -524_arcsec, -872_arcsec, 380_arcsec, 816_arcsec, 111_arcsec,
+          181_arcsec, 19_arcsec, -168_arcsec, 27_arcsec, -189_arcsec,
+          149_arcsec, 129_arcsec, 31_arcsec, -150_arcsec, 158_arcsec, 0_arcsec,
+          -18_arcsec, 131_arcsec, -1_arcsec, 10_arcsec, -74_arcsec, -66_arcsec,
+          79_arcsec, 11_arcsec, -16_arcsec, 13_arcsec, -37_arcsec, 63_arcsec,
+          25_arcsec, -10_arcsec, 44_arcsec, -14_arcsec, -11_arcsec, 25_arcsec,
+          8_arcsec, 2_arcsec, 2_arcsec, -7_arcsec, -15_arcsec, 21_arcsec,
+          -3_arcsec, -21_arcsec, -8_arcsec, 6_arcsec, -24_arcsec, 5_arcsec,
+          -6_arcsec, -2_arcsec, 15_arcsec, -10_arcsec, 8_arcsec, 5_arcsec,
+          7_arcsec, 5_arcsec, 11_arcsec, -10_arcsec, -7_arcsec, -2_arcsec,
+          1_arcsec, 5_arcsec, -13_arcsec, -6_arcsec, 0_arcsec, -353_arcsec,
+          -5_arcsec, 9_arcsec, 0_arcsec, 0_arcsec, 8_arcsec, -2_arcsec,
+          4_arcsec, 0_arcsec},
+      .psi_t_cos = {},
+      .eps_cos = {
+          92052331_arcsec, 5730336_arcsec, 978459_arcsec, -897492_arcsec,
+          73871_arcsec, 224386_arcsec, -6750_arcsec, 200728_arcsec,
+          129025_arcsec, -95929_arcsec, -68982_arcsec, -53311_arcsec,
+          -1235_arcsec, -33228_arcsec, 31429_arcsec, 25543_arcsec, 26366_arcsec,
+          -24236_arcsec, -1220_arcsec, 16452_arcsec, -13870_arcsec, 477_arcsec,
+          13238_arcsec, -12338_arcsec, -10758_arcsec, -609_arcsec, -550_arcsec,
+          8551_arcsec, -8001_arcsec, 6850_arcsec, -167_arcsec, 6953_arcsec,
+          6415_arcsec, 5222_arcsec, 168_arcsec, 3268_arcsec, 104_arcsec,
+          -3250_arcsec, 3353_arcsec, 3070_arcsec, 3272_arcsec, -3045_arcsec,
+          -2768_arcsec, 3041_arcsec, 2695_arcsec, 2719_arcsec, 2720_arcsec,
+          -51_arcsec, -2206_arcsec, -199_arcsec, -1900_arcsec, -41_arcsec,
+          1313_arcsec, 1233_arcsec, -81_arcsec, 1232_arcsec, -20_arcsec,
+          1207_arcsec, 40_arcsec, 1129_arcsec, 1266_arcsec, -1062_arcsec,
+          -1129_arcsec, -9_arcsec, 35_arcsec, -107_arcsec, 1073_arcsec,
+          854_arcsec, -553_arcsec, -710_arcsec, 647_arcsec, -700_arcsec,
+          672_arcsec, 663_arcsec, -594_arcsec, -610_arcsec, -556_arcsec},
+      .eps_t_cos = {
+          9086_arcsec, -3015_arcsec, -485_arcsec, 470_arcsec, -184_arcsec,
+          -677_arcsec, 0_arcsec, 18_arcsec, -63_arcsec, 299_arcsec, -9_arcsec,
+          32_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, -11_arcsec, 0_arcsec,
+          -10_arcsec, 0_arcsec, -11_arcsec, 0_arcsec, 0_arcsec, -11_arcsec,
+          10_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, -2_arcsec, 0_arcsec,
+          -42_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, -1_arcsec,
+          0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec,
+          0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec,
+          0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec,
+          0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec,
+          0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec,
+          0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec, 0_arcsec},
+      .eps_sin = {
+          15377_arcsec, -4587_arcsec, 1374_arcsec, -291_arcsec, -1924_arcsec,
+          -174_arcsec, 358_arcsec, 318_arcsec, 367_arcsec, 132_arcsec,
+          39_arcsec, -4_arcsec, 82_arcsec, -9_arcsec, -75_arcsec, 66_arcsec,
+          78_arcsec, 20_arcsec, 29_arcsec, 68_arcsec, 0_arcsec, -25_arcsec,
+          59_arcsec, -3_arcsec, -3_arcsec, 13_arcsec, 11_arcsec, -45_arcsec,
+          -1_arcsec, -5_arcsec, 13_arcsec, -14_arcsec, 26_arcsec, 15_arcsec,
+          10_arcsec, 19_arcsec, 2_arcsec, -5_arcsec, 14_arcsec, 4_arcsec,
+          4_arcsec, -1_arcsec, -4_arcsec, -5_arcsec, 12_arcsec, -3_arcsec,
+          -9_arcsec, 4_arcsec, 1_arcsec, 2_arcsec, 1_arcsec, 3_arcsec,
+          -1_arcsec, 7_arcsec, 2_arcsec, 4_arcsec, -2_arcsec, 3_arcsec,
+          -2_arcsec, 5_arcsec, -4_arcsec, -3_arcsec, -2_arcsec, 0_arcsec,
+          -2_arcsec, 1_arcsec, -2_arcsec, 0_arcsec, -139_arcsec, -2_arcsec,
+          4_arcsec, 0_arcsec, 0_arcsec, 4_arcsec, -2_arcsec, 2_arcsec,
+          0_arcsec},
+      .eps_t_sin = {},
+  };
+
+  // IAU 2000A
+  // - Fundamental arguments: l, l', F, D and Omega of IAU 2000B, the mean
+  //   longitudes of Mercury to Neptune, and the general accumulated precession
+  //   in longitude p_A (IERS Conventions 2003, eq. 5.44)
+  static constexpr int kArgumentCountIAU2000A{14};
+  static constexpr double kArgumentsIAU2000A[kArgumentCountIAU2000A][5]{
+      {+485868.249036_arcsec, +1717915923.2178_arcsec, +31.8792_arcsec,
+       +0.051635_arcsec, -0.00024470_arcsec},
+      {+1287104.79305_arcsec, +129596581.0481_arcsec, -0.5532_arcsec,
+       +0.000136_arcsec, -0.00001149_arcsec},
+      {+335779.526232_arcsec, +1739527262.8478_arcsec, -12.7512_arcsec,
+       -0.001037_arcsec, +0.00000417_arcsec},
+      {+1072260.70369_arcsec, +1602961601.2090_arcsec, -6.3706_arcsec,
+       +0.006593_arcsec, -0.00003169_arcsec},
+      {+450160.398036_arcsec, -6962890.5431_arcsec, +7.4722_arcsec,
+       +0.007702_arcsec, -0.00005939_arcsec},
+      {4.402608842, 2608.7903141574},
+      {3.176146697, 1021.3285546211},
+      {1.753470314, 628.3075849991},
+      {6.203480913, 334.0612426700},
+      {0.599546497, 52.9690962641},
+      {0.874016757, 21.3299104960},
+      {5.481293872, 7.4781598567},
+      {5.311886287, 3.8133035638},
+      {0.0, 0.024381750, 0.00000538691},
+  };
+  // kMaxMultipleIAU2000A (largest |multiplier|) and
+  // kTermsIAU2000A (Terms<N, kArgumentCountIAU2000A>)
+  // - Source: Not the IERS tables 5.3a/5.3b themselves, but SOFA nut00a.c
+  //   (678 luni-solar and 687 planetary terms, one of each zero), converted
+  //   to their layout by process_nut00a() of Utilities/main.cpp, then run
+  //   through process_iau2000a()
+  // - The terms with the same multipliers are merged: 1323 terms
+  // - Checked against ERFA eraNut00a() within 0.0000001" over 1900-2100
+#include "iau2000a_internal.dat"
 
  protected:
   constexpr EarthNutation() noexcept {}
+
+  static constexpr double kAccuracyTolerances[]{
+      [static_cast<int>(Accuracy::kFull)] = 0.0,
+      [static_cast<int>(Accuracy::k0_1MilliArcSec)] = 0.0001_arcsec,
+      [static_cast<int>(Accuracy::k1MilliArcSec)] = 0.001_arcsec,
+      [static_cast<int>(Accuracy::k10MilliArcSec)] = 0.01_arcsec,
+  };
+
+  // Sums of the terms of a truncation: sin/cos of the multiples of each
+  // fundamental argument by sin_cos_multiples() (kMax: Bound of the
+  // max_multiples), then of the argument of each term by angle addition (see
+  // TermIndices)
+  template <const auto &kTerms, const auto &kArguments, int kMax, int A>
+  static constexpr void ComputeSeries(const Truncation<A> &truncation,
+                                      double tt, double *p_longitude,
+                                      double *p_obliquity) noexcept;
+  static inline const Truncation<kArgumentCountIAU2000A> &
+  GetTruncationIAU2000A(Accuracy accuracy) noexcept;
+  static inline void ComputeSeries(
+      void (*kernel)(const double *, int, double *, double *) noexcept,
+      std::span<const double> tts, std::span<double> longitudes,
+      std::span<double> obliquities);
 };
 
 constexpr void EarthNutation::ComputeNutationIAU1980MeeusTruncated(
@@ -28,11 +476,122 @@ constexpr void EarthNutation::ComputeNutationIAU1980MeeusTruncated(
   double l{280.4665_deg + 36000.7698_deg * t};
   double lm{218.3165_deg + 481267.8813_deg * t};
 
-  *p_longitude = -17.20_arcsec * std::sin(om) - 1.32_arcsec * std::sin(2 * l) -
-                 0.23_arcsec * std::sin(2 * lm) +
-                 0.21_arcsec * std::sin(2 * om);
-  *p_obliquity = 9.20_arcsec * std::cos(om) + 0.57_arcsec * std::cos(2 * l) +
-                 0.10_arcsec * std::cos(2 * lm) - 0.09_arcsec * cos(2 * om);
+  double sin_om{0.0}, cos_om{0.0}, sin_2l{0.0}, cos_2l{0.0}, sin_2lm{0.0},
+      cos_2lm{0.0}, sin_2om{0.0}, cos_2om{0.0};
+  SIMD::SinCos(om, &sin_om, &cos_om);
+  SIMD::SinCos(2 * l, &sin_2l, &cos_2l);
+  SIMD::SinCos(2 * lm, &sin_2lm, &cos_2lm);
+  SIMD::SinCos(2 * om, &sin_2om, &cos_2om);
+  *p_longitude = -17.20_arcsec * sin_om - 1.32_arcsec * sin_2l -
+                 0.23_arcsec * sin_2lm + 0.21_arcsec * sin_2om;
+  *p_obliquity = 9.20_arcsec * cos_om + 0.57_arcsec * cos_2l +
+                 0.10_arcsec * cos_2lm - 0.09_arcsec * cos_2om;
+}
+
+template <int N, int A>
+constexpr EarthNutation::Truncation<A> EarthNutation::GetTruncation(
+    const Terms<N, A> &terms, double tolerance) noexcept {
+  Truncation<A> truncation{.term_count = N, .max_multiples = {}};
+  double dropped_dpsi{0.0};
+  double dropped_deps{0.0};
+  for (; truncation.term_count > 0; truncation.term_count--) {
+    int i{truncation.term_count - 1};
+    dropped_dpsi +=
+        (std::fabs(terms.psi_sin[i]) + std::fabs(terms.psi_t_sin[i]) +
+         std::fabs(terms.psi_cos[i]) + std::fabs(terms.psi_t_cos[i])) /
+        terms.divisor;
+    dropped_deps +=
+        (std::fabs(terms.eps_cos[i]) + std::fabs(terms.eps_t_cos[i]) +
+         std::fabs(terms.eps_sin[i]) + std::fabs(terms.eps_t_sin[i])) /
+        terms.divisor;
+    if (dropped_dpsi > tolerance || dropped_deps > tolerance) break;
+  }
+  for (int a = 0; a < A; a++) {
+    for (int i = 0; i < truncation.term_count; i++) {
+      int multiple{terms.multipliers[a][i] < 0 ? -terms.multipliers[a][i]
+                                               : terms.multipliers[a][i]};
+      if (multiple > truncation.max_multiples[a]) {
+        truncation.max_multiples[a] = multiple;
+      }
+    }
+  }
+  return truncation;
+}
+
+template <const auto &kTerms, int kMax>
+constexpr auto EarthNutation::GetTermIndices() noexcept {
+  constexpr int kTermCount{static_cast<int>(std::size(kTerms.psi_sin))};
+  constexpr int kArguments{static_cast<int>(std::size(kTerms.multipliers))};
+  constexpr int kSlotCount{[] {
+    int slot_count{1};
+    for (int i = 0; i < kTermCount; i++) {
+      int count{0};
+      for (int a = 0; a < kArguments; a++) {
+        if (kTerms.multipliers[a][i] != 0) count++;
+      }
+      if (count > slot_count) slot_count = count;
+    }
+    return slot_count;
+  }()};
+
+  TermIndices<kTermCount, kSlotCount> indices{};
+  for (int i = 0; i < kTermCount; i++) {
+    int slot{0};
+    for (int a = 0; a < kArguments; a++) {
+      if (kTerms.multipliers[a][i] == 0) continue;
+      indices.slots[slot++][i] =
+          a * (2 * kMax + 1) + kTerms.multipliers[a][i] + kMax;
+    }
+    for (; slot < kSlotCount; slot++) indices.slots[slot][i] = kMax;
+  }
+  return indices;
+}
+
+template <const auto &kTerms, const auto &kArguments, int kMax, int A>
+constexpr void EarthNutation::ComputeSeries(const Truncation<A> &truncation,
+                                            double tt, double *p_longitude,
+                                            double *p_obliquity) noexcept {
+  constexpr int kCount{2 * kMax + 1};
+  const auto &terms{kTerms};
+  const auto &slots{kTermIndices<kTerms, kMax>.slots};
+  double t{(tt - PA::EpochJ2000) / 36525.0};
+  double sin_kx[A * kCount];
+  double cos_kx[A * kCount];
+  for (int a = 0; a < A; a++) {
+    sin_cos_multiples<kMax>(horner_polynomial(kArguments[a], t),
+                            sin_kx + a * kCount, cos_kx + a * kCount,
+                            truncation.max_multiples[a]);
+  }
+
+  double sum_dpsi{0.0};
+  double sum_deps{0.0};
+  for (int i = 0; i < truncation.term_count; i++) {
+    double sin_arg{sin_kx[slots[0][i]]}, cos_arg{cos_kx[slots[0][i]]};
+    for (std::size_t slot = 1; slot < std::size(slots); slot++) {
+      int k{slots[slot][i]};
+      double s{sin_arg * cos_kx[k] + cos_arg * sin_kx[k]};
+      cos_arg = cos_arg * cos_kx[k] - sin_arg * sin_kx[k];
+      sin_arg = s;
+    }
+    sum_dpsi += (terms.psi_sin[i] + terms.psi_t_sin[i] * t) * sin_arg +
+                (terms.psi_cos[i] + terms.psi_t_cos[i] * t) * cos_arg;
+    sum_deps += (terms.eps_cos[i] + terms.eps_t_cos[i] * t) * cos_arg +
+                (terms.eps_sin[i] + terms.eps_t_sin[i] * t) * sin_arg;
+  }
+
+  if (p_longitude) *p_longitude = sum_dpsi / terms.divisor;
+  if (p_obliquity) *p_obliquity = sum_deps / terms.divisor;
+}
+
+inline void EarthNutation::ComputeSeries(
+    void (*kernel)(const double *, int, double *, double *) noexcept,
+    std::span<const double> tts, std::span<double> longitudes,
+    std::span<double> obliquities) {
+  assert(longitudes.empty() || longitudes.size() == tts.size());
+  assert(obliquities.empty() || obliquities.size() == tts.size());
+  kernel(tts.data(), static_cast<int>(tts.size()),
+         longitudes.empty() ? nullptr : longitudes.data(),
+         obliquities.empty() ? nullptr : obliquities.data());
 }
 
 constexpr void EarthNutation::ComputeNutationIAU1980(
@@ -46,164 +605,10 @@ constexpr void EarthNutation::ComputeNutationIAU1980(
   // - http://www.neoprogrammics.com/nutations/
   // -
   // https://www.researchgate.net/publication/303154594_On_the_Accuracy_of_the_1980_IAU_Nutation_Series
-  struct {
-    int lm;  // Mean anomaly of the Moon
-    int ls;  // Mean anomaly of the Sun
-    int f;   // Moon's argument of latitude
-    int d;   // Mean elongation of the Moon from the Sun
-    int om;  // Longitude of the ascending node
-    double psi_sin;
-    double psi_t_sin;
-    double eps_cos;
-    double eps_t_cos;
-  } periodic_terms[]{
-      {0, 0, 0, 0, 1, -171996.0_arcsec, -174.2_arcsec, 92025.0_arcsec,
-       8.9_arcsec},
-      {0, 0, 2, -2, 2, -13187.0_arcsec, -1.6_arcsec, 5736.0_arcsec,
-       -3.1_arcsec},
-      {0, 0, 2, 0, 2, -2274.0_arcsec, -0.2_arcsec, 977.0_arcsec, -0.5_arcsec},
-      {0, 0, 0, 0, 2, 2062.0_arcsec, 0.2_arcsec, -895.0_arcsec, 0.5_arcsec},
-      {0, -1, 0, 0, 0, -1426.0_arcsec, 3.4_arcsec, 54.0_arcsec, -0.1_arcsec},
-      {1, 0, 0, 0, 0, 712.0_arcsec, 0.1_arcsec, -7.0_arcsec, 0.0_arcsec},
-      {0, 1, 2, -2, 2, -517.0_arcsec, 1.2_arcsec, 224.0_arcsec, -0.6_arcsec},
-      {0, 0, 2, 0, 1, -386.0_arcsec, -0.4_arcsec, 200.0_arcsec, 0.0_arcsec},
-      {1, 0, 2, 0, 2, -301.0_arcsec, 0.0_arcsec, 129.0_arcsec, -0.1_arcsec},
-      {0, -1, 2, -2, 2, 217.0_arcsec, -0.5_arcsec, -95.0_arcsec, 0.3_arcsec},
-      {-1, 0, 0, 2, 0, 158.0_arcsec, 0.0_arcsec, -1.0_arcsec, 0.0_arcsec},
-      {0, 0, 2, -2, 1, 129.0_arcsec, 0.1_arcsec, -70.0_arcsec, 0.0_arcsec},
-      {-1, 0, 2, 0, 2, 123.0_arcsec, 0.0_arcsec, -53.0_arcsec, 0.0_arcsec},
-      {1, 0, 0, 0, 1, 63.0_arcsec, 0.1_arcsec, -33.0_arcsec, 0.0_arcsec},
-      {0, 0, 0, 2, 0, 63.0_arcsec, 0.0_arcsec, -2.0_arcsec, 0.0_arcsec},
-      {-1, 0, 2, 2, 2, -59.0_arcsec, 0.0_arcsec, 26.0_arcsec, 0.0_arcsec},
-      {-1, 0, 0, 0, 1, -58.0_arcsec, -0.1_arcsec, 32.0_arcsec, 0.0_arcsec},
-      {1, 0, 2, 0, 1, -51.0_arcsec, 0.0_arcsec, 27.0_arcsec, 0.0_arcsec},
-      {-2, 0, 0, 2, 0, -48.0_arcsec, 0.0_arcsec, 1.0_arcsec, 0.0_arcsec},
-      {-2, 0, 2, 0, 1, 46.0_arcsec, 0.0_arcsec, -24.0_arcsec, 0.0_arcsec},
-      {0, 0, 2, 2, 2, -38.0_arcsec, 0.0_arcsec, 16.0_arcsec, 0.0_arcsec},
-      {2, 0, 2, 0, 2, -31.0_arcsec, 0.0_arcsec, 13.0_arcsec, 0.0_arcsec},
-      {2, 0, 0, 0, 0, 29.0_arcsec, 0.0_arcsec, -1.0_arcsec, 0.0_arcsec},
-      {1, 0, 2, -2, 2, 29.0_arcsec, 0.0_arcsec, -12.0_arcsec, 0.0_arcsec},
-      {0, 0, 2, 0, 0, 26.0_arcsec, 0.0_arcsec, -1.0_arcsec, 0.0_arcsec},
-      {0, 0, 2, -2, 0, -22.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {-1, 0, 2, 0, 1, 21.0_arcsec, 0.0_arcsec, -10.0_arcsec, 0.0_arcsec},
-      {0, 2, 0, 0, 0, 17.0_arcsec, -0.1_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {0, 2, 2, -2, 2, -16.0_arcsec, 0.1_arcsec, 7.0_arcsec, 0.0_arcsec},
-      {-1, 0, 0, 2, 1, 16.0_arcsec, 0.0_arcsec, -8.0_arcsec, 0.0_arcsec},
-      {0, 1, 0, 0, 1, -15.0_arcsec, 0.0_arcsec, 9.0_arcsec, 0.0_arcsec},
-      {1, 0, 0, -2, 1, -13.0_arcsec, 0.0_arcsec, 7.0_arcsec, 0.0_arcsec},
-      {0, -1, 0, 0, 1, -12.0_arcsec, 0.0_arcsec, 6.0_arcsec, 0.0_arcsec},
-      {2, 0, -2, 0, 0, 11.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {-1, 0, 2, 2, 1, -10.0_arcsec, 0.0_arcsec, 5.0_arcsec, 0.0_arcsec},
-      {1, 0, 2, 2, 2, -8.0_arcsec, 0.0_arcsec, 3.0_arcsec, 0.0_arcsec},
-      {0, -1, 2, 0, 2, -7.0_arcsec, 0.0_arcsec, 3.0_arcsec, 0.0_arcsec},
-      {0, 0, 2, 2, 1, -7.0_arcsec, 0.0_arcsec, 3.0_arcsec, 0.0_arcsec},
-      {1, 1, 0, -2, 0, -7.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {0, 1, 2, 0, 2, 7.0_arcsec, 0.0_arcsec, -3.0_arcsec, 0.0_arcsec},
-      {-2, 0, 0, 2, 1, -6.0_arcsec, 0.0_arcsec, 3.0_arcsec, 0.0_arcsec},
-      {0, 0, 0, 2, 1, -6.0_arcsec, 0.0_arcsec, 3.0_arcsec, 0.0_arcsec},
-      {2, 0, 2, -2, 2, 6.0_arcsec, 0.0_arcsec, -3.0_arcsec, 0.0_arcsec},
-      {1, 0, 0, 2, 0, 6.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {1, 0, 2, -2, 1, 6.0_arcsec, 0.0_arcsec, -3.0_arcsec, 0.0_arcsec},
-      {0, 0, 0, -2, 1, -5.0_arcsec, 0.0_arcsec, 3.0_arcsec, 0.0_arcsec},
-      {0, -1, 2, -2, 1, -5.0_arcsec, 0.0_arcsec, 3.0_arcsec, 0.0_arcsec},
-      {2, 0, 2, 0, 1, -5.0_arcsec, 0.0_arcsec, 3.0_arcsec, 0.0_arcsec},
-      {1, -1, 0, 0, 0, 5.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {1, 0, 0, -1, 0, -4.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {0, 0, 0, 1, 0, -4.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {0, 1, 0, -2, 0, -4.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {1, 0, -2, 0, 0, 4.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {2, 0, 0, -2, 1, 4.0_arcsec, 0.0_arcsec, -2.0_arcsec, 0.0_arcsec},
-      {0, 1, 2, -2, 1, 4.0_arcsec, 0.0_arcsec, -2.0_arcsec, 0.0_arcsec},
-      {1, 1, 0, 0, 0, -3.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {1, -1, 0, -1, 0, -3.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {-1, -1, 2, 2, 2, -3.0_arcsec, 0.0_arcsec, 1.0_arcsec, 0.0_arcsec},
-      {0, -1, 2, 2, 2, -3.0_arcsec, 0.0_arcsec, 1.0_arcsec, 0.0_arcsec},
-      {1, -1, 2, 0, 2, -3.0_arcsec, 0.0_arcsec, 1.0_arcsec, 0.0_arcsec},
-      {3, 0, 2, 0, 2, -3.0_arcsec, 0.0_arcsec, 1.0_arcsec, 0.0_arcsec},
-      {-2, 0, 2, 0, 2, -3.0_arcsec, 0.0_arcsec, 1.0_arcsec, 0.0_arcsec},
-      {1, 0, 2, 0, 0, 3.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {-1, 0, 2, 4, 2, -2.0_arcsec, 0.0_arcsec, 1.0_arcsec, 0.0_arcsec},
-      {1, 0, 0, 0, 2, -2.0_arcsec, 0.0_arcsec, 1.0_arcsec, 0.0_arcsec},
-      {-1, 0, 2, -2, 1, -2.0_arcsec, 0.0_arcsec, 1.0_arcsec, 0.0_arcsec},
-      {0, -2, 2, -2, 1, -2.0_arcsec, 0.0_arcsec, 1.0_arcsec, 0.0_arcsec},
-      {-2, 0, 0, 0, 1, -2.0_arcsec, 0.0_arcsec, 1.0_arcsec, 0.0_arcsec},
-      {2, 0, 0, 0, 1, 2.0_arcsec, 0.0_arcsec, -1.0_arcsec, 0.0_arcsec},
-      {3, 0, 0, 0, 0, 2.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {1, 1, 2, 0, 2, 2.0_arcsec, 0.0_arcsec, -1.0_arcsec, 0.0_arcsec},
-      {0, 0, 2, 1, 2, 2.0_arcsec, 0.0_arcsec, -1.0_arcsec, 0.0_arcsec},
-      {1, 0, 0, 2, 1, -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {1, 0, 2, 2, 1, -1.0_arcsec, 0.0_arcsec, 1.0_arcsec, 0.0_arcsec},
-      {1, 1, 0, -2, 1, -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {0, 1, 0, 2, 0, -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {0, 1, 2, -2, 0, -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {0, 1, -2, 2, 0, -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {1, 0, -2, 2, 0, -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {1, 0, -2, -2, 0, -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {1, 0, 2, -2, 0, -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {1, 0, 0, -4, 0, -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {2, 0, 0, -4, 0, -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {0, 0, 2, 4, 2, -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {0, 0, 2, -1, 2, -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {-2, 0, 2, 4, 2, -1.0_arcsec, 0.0_arcsec, 1.0_arcsec, 0.0_arcsec},
-      {2, 0, 2, 2, 2, -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {0, -1, 2, 0, 1, -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {0, 0, -2, 0, 1, -1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {0, 0, 4, -2, 2, 1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {0, 1, 0, 0, 2, 1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {1, 1, 2, -2, 2, 1.0_arcsec, 0.0_arcsec, -1.0_arcsec, 0.0_arcsec},
-      {3, 0, 2, -2, 2, 1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {-2, 0, 2, 2, 2, 1.0_arcsec, 0.0_arcsec, -1.0_arcsec, 0.0_arcsec},
-      {-1, 0, 0, 0, 2, 1.0_arcsec, 0.0_arcsec, -1.0_arcsec, 0.0_arcsec},
-      {0, 0, -2, 2, 1, 1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {0, 1, 2, 0, 1, 1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {-1, 0, 4, 0, 2, 1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {2, 1, 0, -2, 0, 1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {2, 0, 0, 2, 0, 1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {2, 0, 2, -2, 1, 1.0_arcsec, 0.0_arcsec, -1.0_arcsec, 0.0_arcsec},
-      {2, 0, -2, 0, 1, 1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {1, -1, 0, -2, 0, 1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {-1, 0, 0, 1, 1, 1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {-1, -1, 0, 2, 1, 1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-      {0, 1, 0, 1, 0, 1.0_arcsec, 0.0_arcsec, 0.0_arcsec, 0.0_arcsec},
-  };
-
-  double t{(tt - PA::EpochJ2000) / 36525.0};
-  double lm{
-      horner_polynomial({134_deg + 57_arcmin + 46.733_arcsec,
-                         1325 * 360_deg + 198_deg + 52_arcmin + 2.633_arcsec,
-                         31.310_arcsec, 0.064_arcsec},
-                        t)};
-  double ls{horner_polynomial({357_deg + 31_arcmin + 39.804_arcsec,
-                               99 * 360_deg + 359_deg + 3_arcmin + 1.224_arcsec,
-                               -0.577_arcsec, -0.012_arcsec},
-                              t)};
-  double f{horner_polynomial({93_deg + 16_arcmin + 18.877_arcsec,
-                              1342 * 360_deg + 82_deg + 1_arcmin + 3.137_arcsec,
-                              -13.257_arcsec, 0.011_arcsec},
-                             t)};
-  double d{
-      horner_polynomial({297_deg + 51_arcmin + 1.307_arcsec,
-                         1236 * 360_deg + 307_deg + 6_arcmin + 41.328_arcsec,
-                         -6.891_arcsec, 0.019_arcsec},
-                        t)};
-  double om{
-      horner_polynomial({125_deg + 2_arcmin + 40.280_arcsec,
-                         -(5 * 360_deg + 134_deg + 8_arcmin + 10.539_arcsec),
-                         7.455_arcsec, 0.008_arcsec},
-                        t)};
-
-  double sum_dpsi{0.0};
-  double sum_deps{0.0};
-  for (auto &pt : periodic_terms) {
-    double arg{lm * pt.lm + ls * pt.ls + f * pt.f + d * pt.d + om * pt.om};
-    double dpsi{(pt.psi_sin + pt.psi_t_sin * t) * std::sin(arg)};
-    double deps{(pt.eps_cos + pt.eps_t_cos * t) * std::cos(arg)};
-    sum_dpsi += dpsi;
-    sum_deps += deps;
-  }
-
-  if (p_longitude) *p_longitude = sum_dpsi / 10000;
-  if (p_obliquity) *p_obliquity = sum_deps / 10000;
+  constexpr Truncation<kArgumentCount> kTruncation{
+      GetTruncation(kTermsIAU1980, 0.0)};
+  ComputeSeries<kTermsIAU1980, kArgumentsIAU1980, kMaxMultiple>(
+      kTruncation, tt, p_longitude, p_obliquity);
 }
 
 constexpr void EarthNutation::ComputeNutationIAU2000B(
@@ -219,212 +624,173 @@ constexpr void EarthNutation::ComputeNutationIAU2000B(
   // -
   // https://www.iers.org/SharedDocs/Publikationen/EN/IERS/Publications/tn/TechnNote29/tn29_111.pdf
   // - [Jean99] Chapter, p.143
+  constexpr Truncation<kArgumentCount> kTruncation{
+      GetTruncation(kTermsIAU2000B, 0.0)};
+  ComputeSeries<kTermsIAU2000B, kArgumentsIAU2000B, kMaxMultiple>(
+      kTruncation, tt, p_longitude, p_obliquity);
+}
 
-  struct {
-    int m1;
-    int m2;
-    int m3;
-    int m4;
-    int m5;
-    double aa;
-    double bb;
-    double cc;
-    double dd;
-    double ee;
-    double ff;
-  } periodic_terms[]{
-      {0, 0, 0, 0, 1, -172064161_arcsec, -174666_arcsec, 33386_arcsec,
-       92052331_arcsec, 9086_arcsec, 15377_arcsec},
-      {0, 0, 2, -2, 2, -13170906_arcsec, -1675_arcsec, -13696_arcsec,
-       5730336_arcsec, -3015_arcsec, -4587_arcsec},
-      {0, 0, 2, 0, 2, -2276413_arcsec, -234_arcsec, 2796_arcsec, 978459_arcsec,
-       -485_arcsec, 1374_arcsec},
-      {0, 0, 0, 0, 2, 2074554_arcsec, 207_arcsec, -698_arcsec, -897492_arcsec,
-       470_arcsec, -291_arcsec},
-      {0, 1, 0, 0, 0, 1475877_arcsec, -3633_arcsec, 11817_arcsec, 73871_arcsec,
-       -184_arcsec, -1924_arcsec},
-      {0, 1, 2, -2, 2, -516821_arcsec, 1226_arcsec, -524_arcsec, 224386_arcsec,
-       -677_arcsec, -174_arcsec},
-      {1, 0, 0, 0, 0, 711159_arcsec, 73_arcsec, -872_arcsec, -6750_arcsec,
-       0_arcsec, 358_arcsec},
-      {0, 0, 2, 0, 1, -387298_arcsec, -367_arcsec, 380_arcsec, 200728_arcsec,
-       18_arcsec, 318_arcsec},
-      {1, 0, 2, 0, 2, -301461_arcsec, -36_arcsec, 816_arcsec, 129025_arcsec,
-       -63_arcsec, 367_arcsec},
-      {0, -1, 2, -2, 2, 215829_arcsec, -494_arcsec, 111_arcsec, -95929_arcsec,
-       299_arcsec, 132_arcsec},
-      {0, 0, 2, -2, 1, 128227_arcsec, 137_arcsec, 181_arcsec, -68982_arcsec,
-       -9_arcsec, 39_arcsec},
-      {-1, 0, 2, 0, 2, 123457_arcsec, 11_arcsec, 19_arcsec, -53311_arcsec,
-       32_arcsec, -4_arcsec},
-      {-1, 0, 0, 2, 0, 156994_arcsec, 10_arcsec, -168_arcsec, -1235_arcsec,
-       0_arcsec, 82_arcsec},
-      {1, 0, 0, 0, 1, 63110_arcsec, 63_arcsec, 27_arcsec, -33228_arcsec,
-       0_arcsec, -9_arcsec},
-      {-1, 0, 0, 0, 1, -57976_arcsec, -63_arcsec, -189_arcsec, 31429_arcsec,
-       0_arcsec, -75_arcsec},
-      {-1, 0, 2, 2, 2, -59641_arcsec, -11_arcsec, 149_arcsec, 25543_arcsec,
-       -11_arcsec, 66_arcsec},
-      {1, 0, 2, 0, 1, -51613_arcsec, -42_arcsec, 129_arcsec, 26366_arcsec,
-       0_arcsec, 78_arcsec},
-      {-2, 0, 2, 0, 1, 45893_arcsec, 50_arcsec, 31_arcsec, -24236_arcsec,
-       -10_arcsec, 20_arcsec},
-      {0, 0, 0, 2, 0, 63384_arcsec, 11_arcsec, -150_arcsec, -1220_arcsec,
-       0_arcsec, 29_arcsec},
-      {0, 0, 2, 2, 2, -38571_arcsec, -1_arcsec, 158_arcsec, 16452_arcsec,
-       -11_arcsec, 68_arcsec},
-      {0, -2, 2, -2, 2, 32481_arcsec, 0_arcsec, 0_arcsec, -13870_arcsec,
-       0_arcsec, 0_arcsec},
-      {-2, 0, 0, 2, 0, -47722_arcsec, 0_arcsec, -18_arcsec, 477_arcsec,
-       0_arcsec, -25_arcsec},
-      {2, 0, 2, 0, 2, -31046_arcsec, -1_arcsec, 131_arcsec, 13238_arcsec,
-       -11_arcsec, 59_arcsec},
-      {1, 0, 2, -2, 2, 28593_arcsec, 0_arcsec, -1_arcsec, -12338_arcsec,
-       10_arcsec, -3_arcsec},
-      {-1, 0, 2, 0, 1, 20441_arcsec, 21_arcsec, 10_arcsec, -10758_arcsec,
-       0_arcsec, -3_arcsec},
-      {2, 0, 0, 0, 0, 29243_arcsec, 0_arcsec, -74_arcsec, -609_arcsec, 0_arcsec,
-       13_arcsec},
-      {0, 0, 2, 0, 0, 25887_arcsec, 0_arcsec, -66_arcsec, -550_arcsec, 0_arcsec,
-       11_arcsec},
-      {0, 1, 0, 0, 1, -14053_arcsec, -25_arcsec, 79_arcsec, 8551_arcsec,
-       -2_arcsec, -45_arcsec},
-      {-1, 0, 0, 2, 1, 15164_arcsec, 10_arcsec, 11_arcsec, -8001_arcsec,
-       0_arcsec, -1_arcsec},
-      {0, 2, 2, -2, 2, -15794_arcsec, 72_arcsec, -16_arcsec, 6850_arcsec,
-       -42_arcsec, -5_arcsec},
-      {0, 0, -2, 2, 0, 21783_arcsec, 0_arcsec, 13_arcsec, -167_arcsec, 0_arcsec,
-       13_arcsec},
-      {1, 0, 0, -2, 1, -12873_arcsec, -10_arcsec, -37_arcsec, 6953_arcsec,
-       0_arcsec, -14_arcsec},
-      {0, -1, 0, 0, 1, -12654_arcsec, 11_arcsec, 63_arcsec, 6415_arcsec,
-       0_arcsec, 26_arcsec},
-      {-1, 0, 2, 2, 1, -10204_arcsec, 0_arcsec, 25_arcsec, 5222_arcsec,
-       0_arcsec, 15_arcsec},
-      {0, 2, 0, 0, 0, 16707_arcsec, -85_arcsec, -10_arcsec, 168_arcsec,
-       -1_arcsec, 10_arcsec},
-      {1, 0, 2, 2, 2, -7691_arcsec, 0_arcsec, 44_arcsec, 3268_arcsec, 0_arcsec,
-       19_arcsec},
-      {-2, 0, 2, 0, 0, -11024_arcsec, 0_arcsec, -14_arcsec, 104_arcsec,
-       0_arcsec, 2_arcsec},
-      {0, 1, 2, 0, 2, 7566_arcsec, -21_arcsec, -11_arcsec, -3250_arcsec,
-       0_arcsec, -5_arcsec},
-      {0, 0, 2, 2, 1, -6637_arcsec, -11_arcsec, 25_arcsec, 3353_arcsec,
-       0_arcsec, 14_arcsec},
-      {0, -1, 2, 0, 2, -7141_arcsec, 21_arcsec, 8_arcsec, 3070_arcsec, 0_arcsec,
-       4_arcsec},
-      {0, 0, 0, 2, 1, -6302_arcsec, -11_arcsec, 2_arcsec, 3272_arcsec, 0_arcsec,
-       4_arcsec},
-      {1, 0, 2, -2, 1, 5800_arcsec, 10_arcsec, 2_arcsec, -3045_arcsec, 0_arcsec,
-       -1_arcsec},
-      {2, 0, 2, -2, 2, 6443_arcsec, 0_arcsec, -7_arcsec, -2768_arcsec, 0_arcsec,
-       -4_arcsec},
-      {-2, 0, 0, 2, 1, -5774_arcsec, -11_arcsec, -15_arcsec, 3041_arcsec,
-       0_arcsec, -5_arcsec},
-      {2, 0, 2, 0, 1, -5350_arcsec, 0_arcsec, 21_arcsec, 2695_arcsec, 0_arcsec,
-       12_arcsec},
-      {0, -1, 2, -2, 1, -4752_arcsec, -11_arcsec, -3_arcsec, 2719_arcsec,
-       0_arcsec, -3_arcsec},
-      {0, 0, 0, -2, 1, -4940_arcsec, -11_arcsec, -21_arcsec, 2720_arcsec,
-       0_arcsec, -9_arcsec},
-      {-1, -1, 0, 2, 0, 7350_arcsec, 0_arcsec, -8_arcsec, -51_arcsec, 0_arcsec,
-       4_arcsec},
-      {2, 0, 0, -2, 1, 4065_arcsec, 0_arcsec, 6_arcsec, -2206_arcsec, 0_arcsec,
-       1_arcsec},
-      {1, 0, 0, 2, 0, 6579_arcsec, 0_arcsec, -24_arcsec, -199_arcsec, 0_arcsec,
-       2_arcsec},
-      {0, 1, 2, -2, 1, 3579_arcsec, 0_arcsec, 5_arcsec, -1900_arcsec, 0_arcsec,
-       1_arcsec},
-      {1, -1, 0, 0, 0, 4725_arcsec, 0_arcsec, -6_arcsec, -41_arcsec, 0_arcsec,
-       3_arcsec},
-      {-2, 0, 2, 0, 2, -3075_arcsec, 0_arcsec, -2_arcsec, 1313_arcsec, 0_arcsec,
-       -1_arcsec},
-      {3, 0, 2, 0, 2, -2904_arcsec, 0_arcsec, 15_arcsec, 1233_arcsec, 0_arcsec,
-       7_arcsec},
-      {0, -1, 0, 2, 0, 4348_arcsec, 0_arcsec, -10_arcsec, -81_arcsec, 0_arcsec,
-       2_arcsec},
-      {1, -1, 2, 0, 2, -2878_arcsec, 0_arcsec, 8_arcsec, 1232_arcsec, 0_arcsec,
-       4_arcsec},
-      {0, 0, 0, 1, 0, -4230_arcsec, 0_arcsec, 5_arcsec, -20_arcsec, 0_arcsec,
-       -2_arcsec},
-      {-1, -1, 2, 2, 2, -2819_arcsec, 0_arcsec, 7_arcsec, 1207_arcsec, 0_arcsec,
-       3_arcsec},
-      {-1, 0, 2, 0, 0, -4056_arcsec, 0_arcsec, 5_arcsec, 40_arcsec, 0_arcsec,
-       -2_arcsec},
-      {0, -1, 2, 2, 2, -2647_arcsec, 0_arcsec, 11_arcsec, 1129_arcsec, 0_arcsec,
-       5_arcsec},
-      {-2, 0, 0, 0, 1, -2294_arcsec, 0_arcsec, -10_arcsec, 1266_arcsec,
-       0_arcsec, -4_arcsec},
-      {1, 1, 2, 0, 2, 2481_arcsec, 0_arcsec, -7_arcsec, -1062_arcsec, 0_arcsec,
-       -3_arcsec},
-      {2, 0, 0, 0, 1, 2179_arcsec, 0_arcsec, -2_arcsec, -1129_arcsec, 0_arcsec,
-       -2_arcsec},
-      {-1, 1, 0, 1, 0, 3276_arcsec, 0_arcsec, 1_arcsec, -9_arcsec, 0_arcsec,
-       0_arcsec},
-      {1, 1, 0, 0, 0, -3389_arcsec, 0_arcsec, 5_arcsec, 35_arcsec, 0_arcsec,
-       -2_arcsec},
-      {1, 0, 2, 0, 0, 3339_arcsec, 0_arcsec, -13_arcsec, -107_arcsec, 0_arcsec,
-       1_arcsec},
-      {-1, 0, 2, -2, 1, -1987_arcsec, 0_arcsec, -6_arcsec, 1073_arcsec,
-       0_arcsec, -2_arcsec},
-      {1, 0, 0, 0, 2, -1981_arcsec, 0_arcsec, 0_arcsec, 854_arcsec, 0_arcsec,
-       0_arcsec},
-      {-1, 0, 0, 1, 0, 4026_arcsec, 0_arcsec, -353_arcsec, -553_arcsec,
-       0_arcsec, -139_arcsec},
-      {0, 0, 2, 1, 2, 1660_arcsec, 0_arcsec, -5_arcsec, -710_arcsec, 0_arcsec,
-       -2_arcsec},
-      {-1, 0, 2, 4, 2, -1521_arcsec, 0_arcsec, 9_arcsec, 647_arcsec, 0_arcsec,
-       4_arcsec},
-      {-1, 1, 0, 1, 1, 1314_arcsec, 0_arcsec, 0_arcsec, -700_arcsec, 0_arcsec,
-       0_arcsec},
-      {0, -2, 2, -2, 1, -1283_arcsec, 0_arcsec, 0_arcsec, 672_arcsec, 0_arcsec,
-       0_arcsec},
-      {1, 0, 2, 2, 1, -1331_arcsec, 0_arcsec, 8_arcsec, 663_arcsec, 0_arcsec,
-       4_arcsec},
-      {-2, 0, 2, 2, 2, 1383_arcsec, 0_arcsec, -2_arcsec, -594_arcsec, 0_arcsec,
-       -2_arcsec},
-      {-1, 0, 0, 0, 2, 1405_arcsec, 0_arcsec, 4_arcsec, -610_arcsec, 0_arcsec,
-       2_arcsec},
-      {1, 1, 2, -2, 2, 1290_arcsec, 0_arcsec, 0_arcsec, -556_arcsec, 0_arcsec,
-       0_arcsec},
-  };
+inline void EarthNutation::ComputeNutationIAU1980(
+    std::span<const double> tts, std::span<double> longitudes,
+    std::span<double> obliquities) {
+  ComputeSeries(SIMD::GetKernels().nutation_iau1980, tts, longitudes,
+                obliquities);
+}
 
-  double t{(tt - PA::EpochJ2000) / 36525.0};
-  double l{
-      horner_polynomial({+485868.249036_arcsec, +1717915923.2178_arcsec,
-                         +31.8792_arcsec, +0.051635_arcsec, -0.00024470_arcsec},
-                        t)};
-  double lp{
-      horner_polynomial({+1287104.79305_arcsec, +129596581.0481_arcsec,
-                         -0.5532_arcsec, +0.000136_arcsec, -0.00001149_arcsec},
-                        t)};
-  double f{
-      horner_polynomial({+335779.526232_arcsec, +1739527262.8478_arcsec,
-                         -12.7512_arcsec, -0.001037_arcsec, +0.00000417_arcsec},
-                        t)};
-  double d{
-      horner_polynomial({+1072260.70369_arcsec, +1602961601.2090_arcsec,
-                         -6.3706_arcsec, +0.006593_arcsec, -0.00003169_arcsec},
-                        t)};
-  double om{
-      horner_polynomial({+450160.398036_arcsec, -6962890.5431_arcsec,
-                         +7.4722_arcsec, +0.007702_arcsec, -0.00005939_arcsec},
-                        t)};
+inline void EarthNutation::ComputeNutationIAU2000B(
+    std::span<const double> tts, std::span<double> longitudes,
+    std::span<double> obliquities) {
+  ComputeSeries(SIMD::GetKernels().nutation_iau2000b, tts, longitudes,
+                obliquities);
+}
 
-  double sum_dpsi{0.0};
-  double sum_deps{0.0};
-  for (auto &pt : periodic_terms) {
-    double arg{l * pt.m1 + lp * pt.m2 + f * pt.m3 + d * pt.m4 + om * pt.m5};
-    double dpsi{(pt.aa + pt.bb * t) * std::sin(arg) + pt.cc * std::cos(arg)};
-    double deps{(pt.dd + pt.ee * t) * std::cos(arg) + pt.ff * std::sin(arg)};
-    sum_dpsi += dpsi;
-    sum_deps += deps;
+inline const EarthNutation::Truncation<EarthNutation::kArgumentCountIAU2000A> &
+EarthNutation::GetTruncationIAU2000A(
+    EarthNutation::Accuracy accuracy) noexcept {
+  // Of each accuracy target, at compile time
+  static constexpr auto kTruncations{[] {
+    std::array<Truncation<kArgumentCountIAU2000A>,
+               static_cast<int>(Accuracy::kMax)>
+        truncations{};
+    for (int a = 0; a < static_cast<int>(Accuracy::kMax); a++) {
+      truncations[a] = GetTruncation(kTermsIAU2000A, kAccuracyTolerances[a]);
+    }
+    return truncations;
+  }()};
+  return kTruncations[static_cast<int>(accuracy)];
+}
+
+inline int EarthNutation::GetTermCountIAU2000A(
+    EarthNutation::Accuracy accuracy) noexcept {
+  return GetTruncationIAU2000A(accuracy).term_count;
+}
+
+inline void EarthNutation::ComputeNutationIAU2000A(
+    double tt, double *p_longitude, double *p_obliquity,
+    EarthNutation::Accuracy accuracy) noexcept {
+  // IAU 2000A Nutation Model (MHB2000)
+  // Accuracy: About 0.0002" w.r.t. VLBI observations, full series
+  // Tables: See kTermsIAU2000A
+  // References:
+  // -
+  // https://iers-conventions.obspm.fr/content/chapter5/additional_info/tab5.3a.txt
+  // -
+  // https://iers-conventions.obspm.fr/content/chapter5/additional_info/tab5.3b.txt
+  // - http://www.iausofa.org/2018_0130_F/sofa/nut00a.for
+  // -
+  // https://www.iers.org/SharedDocs/Publikationen/EN/IERS/Publications/tn/TechnNote32/tn32_033.pdf
+  ComputeSeries<kTermsIAU2000A, kArgumentsIAU2000A, kMaxMultipleIAU2000A>(
+      GetTruncationIAU2000A(accuracy), tt, p_longitude, p_obliquity);
+}
+
+inline void EarthNutation::ComputeNutationIAU2000A(
+    std::span<const double> tts, std::span<double> longitudes,
+    std::span<double> obliquities, EarthNutation::Accuracy accuracy) {
+  assert(longitudes.empty() || longitudes.size() == tts.size());
+  assert(obliquities.empty() || obliquities.size() == tts.size());
+  const Truncation<kArgumentCountIAU2000A> &truncation{
+      GetTruncationIAU2000A(accuracy)};
+  SIMD::GetKernels().nutation_iau2000a(
+      tts.data(), static_cast<int>(tts.size()), truncation.term_count,
+      truncation.max_multiples,
+      longitudes.empty() ? nullptr : longitudes.data(),
+      obliquities.empty() ? nullptr : obliquities.data());
+}
+
+namespace SIMD {
+inline namespace PA_SIMD_ISA {
+
+// EarthNutation::ComputeSeries() over size epochs, an epoch per lane; outputs
+// skipped if nullptr
+// - The first term_count terms, with the multiples up to max_multiples[a] of
+//   the arguments (see EarthNutation::Truncation)
+// - Only code of this namespace (see simd_kernels.cpp)
+template <const auto &kTerms, const auto &kArguments, int kMax>
+inline void ComputeNutation(const double *tts, int size, int term_count,
+                            const int *max_multiples, double *longitudes,
+                            double *obliquities) noexcept {
+  constexpr int kArgumentCount{static_cast<int>(std::size(kArguments))};
+  constexpr int kDegreeCount{static_cast<int>(std::size(kArguments[0]))};
+  constexpr int kCount{2 * kMax + 1};
+  const auto &terms{kTerms};
+  const auto &slots{EarthNutation::kTermIndices<kTerms, kMax>.slots};
+  for (int i = 0; i < size; i += kWidth) {
+    int count{size - i < kWidth ? size - i : kWidth};
+    // Lanes past the end repeat the first epoch
+    VecD tt{Broadcast(tts[i])};
+    for (int lane = 0; lane < count; lane++) tt[lane] = tts[i + lane];
+    VecD t{(tt - EpochJ2000) / 36525.0};
+
+    VecD sin_kx[kArgumentCount * kCount], cos_kx[kArgumentCount * kCount];
+    for (int a = 0; a < kArgumentCount; a++) {
+      VecD x{Broadcast(kArguments[a][kDegreeCount - 1])};
+      for (int k = kDegreeCount - 2; k >= 0; k--) x = x * t + kArguments[a][k];
+      SinCosMultiples<kMax>(x, sin_kx + a * kCount, cos_kx + a * kCount,
+                            max_multiples[a]);
+    }
+
+    VecD sum_dpsi{}, sum_deps{};
+    for (int j = 0; j < term_count; j++) {
+      VecD sin_arg{sin_kx[slots[0][j]]}, cos_arg{cos_kx[slots[0][j]]};
+      for (std::size_t slot = 1; slot < std::size(slots); slot++) {
+        int k{slots[slot][j]};
+        VecD s{sin_arg * cos_kx[k] + cos_arg * sin_kx[k]};
+        cos_arg = cos_arg * cos_kx[k] - sin_arg * sin_kx[k];
+        sin_arg = s;
+      }
+      sum_dpsi += (terms.psi_sin[j] + terms.psi_t_sin[j] * t) * sin_arg +
+                  (terms.psi_cos[j] + terms.psi_t_cos[j] * t) * cos_arg;
+      sum_deps += (terms.eps_cos[j] + terms.eps_t_cos[j] * t) * cos_arg +
+                  (terms.eps_sin[j] + terms.eps_t_sin[j] * t) * sin_arg;
+    }
+    sum_dpsi /= terms.divisor;
+    sum_deps /= terms.divisor;
+    for (int lane = 0; lane < count; lane++) {
+      if (longitudes) longitudes[i + lane] = sum_dpsi[lane];
+      if (obliquities) obliquities[i + lane] = sum_deps[lane];
+    }
   }
+}
 
-  if (p_longitude) *p_longitude = sum_dpsi / 10000000.0;
-  if (p_obliquity) *p_obliquity = sum_deps / 10000000.0;
+inline void ComputeNutationIAU1980(const double *tts, int size,
+                                   double *longitudes,
+                                   double *obliquities) noexcept {
+  constexpr EarthNutation::Truncation<EarthNutation::kArgumentCount>
+      kTruncation{EarthNutation::GetTruncation(EarthNutation::kTermsIAU1980,
+                                               0.0)};
+  ComputeNutation<EarthNutation::kTermsIAU1980,
+                  EarthNutation::kArgumentsIAU1980,
+                  EarthNutation::kMaxMultiple>(
+      tts, size, kTruncation.term_count, kTruncation.max_multiples, longitudes,
+      obliquities);
 }
 
+inline void ComputeNutationIAU2000B(const double *tts, int size,
+                                    double *longitudes,
+                                    double *obliquities) noexcept {
+  constexpr EarthNutation::Truncation<EarthNutation::kArgumentCount>
+      kTruncation{EarthNutation::GetTruncation(EarthNutation::kTermsIAU2000B,
+                                               0.0)};
+  ComputeNutation<EarthNutation::kTermsIAU2000B,
+                  EarthNutation::kArgumentsIAU2000B,
+                  EarthNutation::kMaxMultiple>(
+      tts, size, kTruncation.term_count, kTruncation.max_multiples, longitudes,
+      obliquities);
+}
+
+inline void ComputeNutationIAU2000A(const double *tts, int size,
+                                    int term_count, const int *max_multiples,
+                                    double *longitudes,
+                                    double *obliquities) noexcept {
+  ComputeNutation<EarthNutation::kTermsIAU2000A,
+                  EarthNutation::kArgumentsIAU2000A,
+                  EarthNutation::kMaxMultipleIAU2000A>(
+      tts, size, term_count, max_multiples, longitudes, obliquities);
+}
+
+}  // namespace PA_SIMD_ISA
+}  // namespace SIMD
+
 /*--- ??? Obsolete ---*/
 
 class EarthNutationOld {
@@ -1,7 +1,14 @@
 #ifndef ELP82JM_H_
 #define ELP82JM_H_
 
+#include <cassert>
+#include <cstddef>
+#include <span>
+
 #include "radian.h"
+#include "simd.h"
+#include "simd_dispatch.h"
+#include "thread_pool.h"
 #include "utils.h"
 
 using namespace PA;
@@ -17,6 +24,149 @@ class ELP82JM {
   static constexpr void Compute(double tt, double* p_longitude,
                                 double* p_latitude,
                                 double* p_radius_vector_km) noexcept;
+  // Batch over the epochs tts, an epoch per lane of the vectors of the host
+  // ISA (see SIMD::ComputeELP82JM() and simd_dispatch.h), with the rates
+  // (radians or km per day) from the same sin/cos of each term
+  // - Outputs are skipped when their span is empty, otherwise they must have
+  //   the size of tts
+  static inline void Compute(std::span<const double> tts,
+                             std::span<double> longitudes,
+                             std::span<double> latitudes,
+                             std::span<double> radius_vectors_km,
+                             std::span<double> longitude_rates = {},
+                             std::span<double> latitude_rates = {},
+                             std::span<double> radius_vector_km_rates = {});
+  // Same, on the threads of a pool (see ThreadPool)
+  static inline void Compute(ThreadPool& pool, std::span<const double> tts,
+                             std::span<double> longitudes,
+                             std::span<double> latitudes,
+                             std::span<double> radius_vectors_km);
+
+  /* Tables
+   * - Shared by the scalar and the vector evaluations
+   * - Arguments: Coefficients of the powers of t, in Julian centuries from
+   *   J2000
+   */
+
+  // Moon's mean longitude, referred to the mean equinox of the date, and
+  // including the constant term of the effect of the light-time (-0.70")
+  static constexpr double kMeanLongitude[]{
+      218.3164477_deg, 481267.88123421_deg, -0.0015786_deg, 1.0_deg / 538841.0,
+      -1.0_deg / 65194000};
+  // Mean elongation of the Moon
+  static constexpr double kMeanElongation[]{
+      297.8501921_deg, 445267.1114034_deg, -0.0018819_deg, 1.0_deg / 545868.0,
+      -1.0_deg / 113065000.0};
+  // Sun's mean anomaly
+  static constexpr double kSunMeanAnomaly[]{
+      357.5291092_deg, 35999.0502909_deg, -0.0001536_deg,
+      1.0_deg / 24490000.0};
+  // Moon's mean anomaly
+  static constexpr double kMoonMeanAnomaly[]{
+      134.9633964_deg, 477198.8675055_deg, 0.0087414_deg, 1.0_deg / 69699.0,
+      -1.0_deg / 14712000.0};
+  // Moon's argument of latitude (mean distance of the Moon from its ascending
+  // node)
+  static constexpr double kArgumentOfLatitude[]{
+      93.2720950_deg, 483202.0175233_deg, -0.0036539_deg,
+      -1.0_deg / 3526000.0, 1.0_deg / 863310000.0};
+  static constexpr double kA1[]{119.75_deg, 131.849_deg};
+  static constexpr double kA2[]{53.09_deg, 479264.290_deg};
+  static constexpr double kA3[]{313.45_deg, 481266.484_deg};
+  // Eccentricity of the Earth's orbit, as a factor of the terms with M
+  static constexpr double kEccentricity[]{1.0, -0.002516, -0.0000074};
+
+  // Largest |multiplier| of D, M, M' and F in the periodic terms
+  static constexpr int kMaxMultiple{4};
+  static constexpr int kMultipleCount{2 * kMaxMultiple + 1};
+  static constexpr int kTermCount{60};
+
+  // Periodic terms, structure-of-arrays: Multipliers of D, M, M' and F, and
+  // the coefficients (10^-6 of the units of the results, or 10^-3 km)
+  // - Longitude (sin) and distance (cos), [Jean99] Table 47.A
+  struct TermsLR {
+    alignas(64) int d[kTermCount];
+    alignas(64) int m[kTermCount];
+    alignas(64) int mp[kTermCount];
+    alignas(64) int f[kTermCount];
+    alignas(64) double l[kTermCount];
+    alignas(64) double r[kTermCount];
+  };
+  // - Latitude (sin), [Jean99] Table 47.B
+  struct TermsB {
+    alignas(64) int d[kTermCount];
+    alignas(64) int m[kTermCount];
+    alignas(64) int mp[kTermCount];
+    alignas(64) int f[kTermCount];
+    alignas(64) double b[kTermCount];
+  };
+
+  static constexpr TermsLR kTermsLR{
+      .d = {
+          0, 2, 2, 0, 0, 0, 2, 2, 2, 2, 0, 1, 0, 2, 0, 0, 4, 0, 4, 2, 2, 1, 1,
+          2, 2, 4, 2, 0, 2, 2, 1, 2, 0, 0, 2, 2, 2, 4, 0, 3, 2, 4, 0, 2, 2, 2,
+          4, 0, 4, 1, 2, 0, 1, 3, 4, 2, 0, 1, 2, 2},
+      .m = {
+          0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0,
+          1, -1, 0, 0, 0, 1, 0, -1, 0, -2, 1, 2, -2, 0, 0, -1, 0, 0, 1, -1, 2,
+          2, 1, -1, 0, 0, -1, 0, 1, 0, 1, 0, 0, -1, 2, 1, 0, 0},
+      .mp = {
+          1, -1, 0, 2, 0, 0, -2, -1, 1, 0, -1, 0, 1, 0, 1, 1, -1, 3, -2, -1, 0,
+          -1, 0, 1, 2, 0, -3, -2, -1, -2, 1, 0, 2, 0, -1, 1, 0, -1, 2, -1, 1,
+          -2, -1, -1, -2, 0, 1, 4, 0, -2, 0, 2, 1, -2, -3, 2, 1, -1, 3, -1},
+      .f = {
+          0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, -2, 2, -2, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -2, 2, 0, 2, 0, 0, 0, 0, 0, 0,
+          -2, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, -2},
+      .l = {
+          6288774_deg, 1274027_deg, 658314_deg, 213618_deg, -185116_deg,
+          -114332_deg, 58793_deg, 57066_deg, 53322_deg, 45758_deg, -40923_deg,
+          -34720_deg, -30383_deg, 15327_deg, -12528_deg, 10980_deg, 10675_deg,
+          10034_deg, 8548_deg, -7888_deg, -6766_deg, -5163_deg, 4987_deg,
+          4036_deg, 3994_deg, 3861_deg, 3665_deg, -2689_deg, -2602_deg,
+          2390_deg, -2348_deg, 2236_deg, -2120_deg, -2069_deg, 2048_deg,
+          -1773_deg, -1595_deg, 1215_deg, -1110_deg, -892_deg, -810_deg,
+          759_deg, -713_deg, -700_deg, 691_deg, 596_deg, 549_deg, 537_deg,
+          520_deg, -487_deg, -399_deg, -381_deg, 351_deg, -340_deg, 330_deg,
+          327_deg, -323_deg, 299_deg, 294_deg, 0_deg},
+      .r = {
+          -20905355, -3699111, -2955968, -569925, 48888, -3149, 246158,
+          -152138, -170733, -204586, -129620, 108743, 104755, 10321, 0, 79661,
+          -34782, -23210, -21636, 24208, 30824, -8379, -16675, -12831, -10445,
+          -11650, 14403, -7003, 0, 10056, 6322, -9884, 5751, 0, -4950, 4130, 0,
+          -3958, 0, 3258, 2616, -1897, -2117, 2354, 0, 0, -1423, -1117, -1571,
+          -1739, 0, -4421, 0, 0, 0, 0, 1165, 0, 0, 8752},
+  };
+  static constexpr TermsB kTermsB{
+      .d = {
+          0, 0, 0, 2, 2, 2, 2, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0, 4, 0, 0, 0, 1,
+          0, 0, 0, 1, 0, 4, 4, 0, 4, 2, 2, 2, 2, 0, 2, 2, 2, 2, 4, 2, 2, 0, 2,
+          1, 1, 0, 2, 1, 2, 0, 4, 4, 1, 4, 1, 4, 2},
+      .m = {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, -1, -1, -1, 1, 0, 1, 0, 1,
+          0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 1, 0, -1, -2,
+          0, 1, 1, 1, 1, 1, 0, -1, 1, 0, -1, 0, 0, 0, -1, -2},
+      .mp = {
+          0, 1, 1, 0, -1, -1, 0, 2, 1, 2, 0, -2, 1, 0, -1, 0, -1, -1, -1, 0, 0,
+          -1, 0, 1, 1, 0, 0, 3, 0, -1, 1, -2, 0, 2, 1, -2, 3, 2, -3, -1, 0, 0,
+          1, 0, 1, 1, 0, 0, -2, -1, 1, -2, 2, -2, -1, 1, 1, -1, 0, 0},
+      .f = {
+          1, 1, -1, -1, 1, -1, 1, 1, -1, -1, -1, -1, 1, -1, 1, 1, -1, -1, -1,
+          1, 3, 1, 1, 1, -1, -1, -1, 1, -1, 1, -3, 1, -3, -1, -1, 1, -1, 1, -1,
+          1, 1, 1, 1, -1, 3, -1, -1, 1, -1, -1, 1, -1, 1, -1, -1, -1, -1, -1,
+          -1, 1},
+      .b = {
+          5128122_deg, 280602_deg, 277693_deg, 173237_deg, 55413_deg,
+          46271_deg, 32573_deg, 17198_deg, 9266_deg, 8822_deg, 8216_deg,
+          4324_deg, 4200_deg, -3359_deg, 2463_deg, 2211_deg, 2065_deg,
+          -1870_deg, 1828_deg, -1794_deg, -1749_deg, -1565_deg, -1491_deg,
+          -1475_deg, -1410_deg, -1344_deg, -1335_deg, 1107_deg, 1021_deg,
+          833_deg, 777_deg, 671_deg, 607_deg, 596_deg, 491_deg, -451_deg,
+          439_deg, 422_deg, 421_deg, -366_deg, -351_deg, 331_deg, 315_deg,
+          302_deg, -283_deg, -229_deg, 223_deg, 223_deg, -220_deg, -220_deg,
+          -185_deg, 181_deg, -177_deg, 176_deg, 166_deg, -164_deg, 132_deg,
+          -119_deg, 115_deg, 107_deg},
+  };
 
  private:
   constexpr ELP82JM() noexcept {};
@@ -28,161 +178,68 @@ constexpr void ELP82JM::Compute(double tt, double* p_longitude,
   // References:
   // - [Jean99] Chapter 47, pp.337-344
   double t{(tt - EpochJ2000) / 36525.0};
-  // Moon's mean longitude, referred to the mean equinox of the date, and
-  // including the constant term of the effect of the light-time (-0.70")
-  double lp{
-      horner_polynomial({218.3164477_deg, 481267.88123421_deg, -0.0015786_deg,
-                         1.0_deg / 538841.0, -1.0_deg / 65194000},
-                        t)};
-  // Mean elongation of the Moon
-  double d{
-      horner_polynomial({297.8501921_deg, 445267.1114034_deg, -0.0018819_deg,
-                         1.0_deg / 545868.0, -1.0_deg / 113065000.0},
-                        t)};
-  // Sun's mean anomaly
-  double m{horner_polynomial({357.5291092_deg, 35999.0502909_deg,
-                              -0.0001536_deg, 1.0_deg / 24490000.0},
-                             t)};
-  // Moon's mean anomaly
-  double mp{
-      horner_polynomial({134.9633964_deg, 477198.8675055_deg, 0.0087414_deg,
-                         1.0_deg / 69699.0, -1.0_deg / 14712000.0},
-                        t)};
-  // Moon's argument of latitude (mean distance of the Moon from its ascending
-  // node)
-  double f{
-      horner_polynomial({93.2720950_deg, 483202.0175233_deg, -0.0036539_deg,
-                         -1.0_deg / 3526000.0, 1.0_deg / 863310000.0},
-                        t)};
-  double a1{119.75_deg + 131.849_deg * t};
-  double a2{53.09_deg + 479264.290_deg * t};
-  double a3{313.45_deg + 481266.484_deg * t};
-  double e{1 + (-0.002516 - 0.0000074 * t) * t};
+  double lp{horner_polynomial(kMeanLongitude, t)};
+  double d{horner_polynomial(kMeanElongation, t)};
+  double m{horner_polynomial(kSunMeanAnomaly, t)};
+  double mp{horner_polynomial(kMoonMeanAnomaly, t)};
+  double f{horner_polynomial(kArgumentOfLatitude, t)};
+  double a1{horner_polynomial(kA1, t)};
+  double a2{horner_polynomial(kA2, t)};
+  double a3{horner_polynomial(kA3, t)};
+  double e{horner_polynomial(kEccentricity, t)};
   double e2{e * e};
   double es_internal[]{e2, e, 1.0, e, e2};
   double* es{es_internal + 2};
-  struct {
-    int d;
-    int m;
-    int mp;
-    int f;
-    double l;
-    double r;
-  } periodic_terms_lr[]{
-      {0, 0, 1, 0, 6288774_deg, -20905355},
-      {2, 0, -1, 0, 1274027_deg, -3699111},
-      {2, 0, 0, 0, 658314_deg, -2955968},
-      {0, 0, 2, 0, 213618_deg, -569925},
-      {0, 1, 0, 0, -185116_deg, 48888},
-      {0, 0, 0, 2, -114332_deg, -3149},
-      {2, 0, -2, 0, 58793_deg, 246158},
-      {2, -1, -1, 0, 57066_deg, -152138},
-      {2, 0, 1, 0, 53322_deg, -170733},
-      {2, -1, 0, 0, 45758_deg, -204586},
-      {0, 1, -1, 0, -40923_deg, -129620},
-      {1, 0, 0, 0, -34720_deg, 108743},
-      {0, 1, 1, 0, -30383_deg, 104755},
-      {2, 0, 0, -2, 15327_deg, 10321},
-      {0, 0, 1, 2, -12528_deg, 0},
-      {0, 0, 1, -2, 10980_deg, 79661},
-      {4, 0, -1, 0, 10675_deg, -34782},
-      {0, 0, 3, 0, 10034_deg, -23210},
-      {4, 0, -2, 0, 8548_deg, -21636},
-      {2, 1, -1, 0, -7888_deg, 24208},
-      {2, 1, 0, 0, -6766_deg, 30824},
-      {1, 0, -1, 0, -5163_deg, -8379},
-      {1, 1, 0, 0, 4987_deg, -16675},
-      {2, -1, 1, 0, 4036_deg, -12831},
-      {2, 0, 2, 0, 3994_deg, -10445},
-      {4, 0, 0, 0, 3861_deg, -11650},
-      {2, 0, -3, 0, 3665_deg, 14403},
-      {0, 1, -2, 0, -2689_deg, -7003},
-      {2, 0, -1, 2, -2602_deg, 0},
-      {2, -1, -2, 0, 2390_deg, 10056},
-      {1, 0, 1, 0, -2348_deg, 6322},
-      {2, -2, 0, 0, 2236_deg, -9884},
-      {0, 1, 2, 0, -2120_deg, 5751},
-      {0, 2, 0, 0, -2069_deg, 0},
-      {2, -2, -1, 0, 2048_deg, -4950},
-      {2, 0, 1, -2, -1773_deg, 4130},
-      {2, 0, 0, 2, -1595_deg, 0},
-      {4, -1, -1, 0, 1215_deg, -3958},
-      {0, 0, 2, 2, -1110_deg, 0},
-      {3, 0, -1, 0, -892_deg, 3258},
-      {2, 1, 1, 0, -810_deg, 2616},
-      {4, -1, -2, 0, 759_deg, -1897},
-      {0, 2, -1, 0, -713_deg, -2117},
-      {2, 2, -1, 0, -700_deg, 2354},
-      {2, 1, -2, 0, 691_deg, 0},
-      {2, -1, 0, -2, 596_deg, 0},
-      {4, 0, 1, 0, 549_deg, -1423},
-      {0, 0, 4, 0, 537_deg, -1117},
-      {4, -1, 0, 0, 520_deg, -1571},
-      {1, 0, -2, 0, -487_deg, -1739},
-      {2, 1, 0, -2, -399_deg, 0},
-      {0, 0, 2, -2, -381_deg, -4421},
-      {1, 1, 1, 0, 351_deg, 0},
-      {3, 0, -2, 0, -340_deg, 0},
-      {4, 0, -3, 0, 330_deg, 0},
-      {2, -1, 2, 0, 327_deg, 0},
-      {0, 2, 1, 0, -323_deg, 1165},
-      {1, 1, -1, 0, 299_deg, 0},
-      {2, 0, 3, 0, 294_deg, 0},
-      {2, 0, -1, -2, 0_deg, 8752},
-  };
-  struct {
-    int d;
-    int m;
-    int mp;
-    int f;
-    double b;
-  } periodic_terms_b[]{
-      {0, 0, 0, 1, 5128122_deg}, {0, 0, 1, 1, 280602_deg},
-      {0, 0, 1, -1, 277693_deg}, {2, 0, 0, -1, 173237_deg},
-      {2, 0, -1, 1, 55413_deg},  {2, 0, -1, -1, 46271_deg},
-      {2, 0, 0, 1, 32573_deg},   {0, 0, 2, 1, 17198_deg},
-      {2, 0, 1, -1, 9266_deg},   {0, 0, 2, -1, 8822_deg},
-      {2, -1, 0, -1, 8216_deg},  {2, 0, -2, -1, 4324_deg},
-      {2, 0, 1, 1, 4200_deg},    {2, 1, 0, -1, -3359_deg},
-      {2, -1, -1, 1, 2463_deg},  {2, -1, 0, 1, 2211_deg},
-      {2, -1, -1, -1, 2065_deg}, {0, 1, -1, -1, -1870_deg},
-      {4, 0, -1, -1, 1828_deg},  {0, 1, 0, 1, -1794_deg},
-      {0, 0, 0, 3, -1749_deg},   {0, 1, -1, 1, -1565_deg},
-      {1, 0, 0, 1, -1491_deg},   {0, 1, 1, 1, -1475_deg},
-      {0, 1, 1, -1, -1410_deg},  {0, 1, 0, -1, -1344_deg},
-      {1, 0, 0, -1, -1335_deg},  {0, 0, 3, 1, 1107_deg},
-      {4, 0, 0, -1, 1021_deg},   {4, 0, -1, 1, 833_deg},
-      {0, 0, 1, -3, 777_deg},    {4, 0, -2, 1, 671_deg},
-      {2, 0, 0, -3, 607_deg},    {2, 0, 2, -1, 596_deg},
-      {2, -1, 1, -1, 491_deg},   {2, 0, -2, 1, -451_deg},
-      {0, 0, 3, -1, 439_deg},    {2, 0, 2, 1, 422_deg},
-      {2, 0, -3, -1, 421_deg},   {2, 1, -1, 1, -366_deg},
-      {2, 1, 0, 1, -351_deg},    {4, 0, 0, 1, 331_deg},
-      {2, -1, 1, 1, 315_deg},    {2, -2, 0, -1, 302_deg},
-      {0, 0, 1, 3, -283_deg},    {2, 1, 1, -1, -229_deg},
-      {1, 1, 0, -1, 223_deg},    {1, 1, 0, 1, 223_deg},
-      {0, 1, -2, -1, -220_deg},  {2, 1, -1, -1, -220_deg},
-      {1, 0, 1, 1, -185_deg},    {2, -1, -2, -1, 181_deg},
-      {0, 1, 2, 1, -177_deg},    {4, 0, -2, -1, 176_deg},
-      {4, -1, -1, -1, 166_deg},  {1, 0, 1, -1, -164_deg},
-      {4, 0, 1, -1, 132_deg},    {1, 0, -1, -1, -119_deg},
-      {4, -1, 0, -1, 115_deg},   {2, -2, 0, 1, 107_deg},
-  };
 
-  double sum_l{3958_deg * std::sin(a1) + 1962_deg * std::sin(lp - f) +
-               318_deg * std::sin(a2)};
+  // sin/cos of the multiples of the fundamental arguments, so that the
+  // library sin/cos (see simd.h) is called only for these and for a1, a2, a3
+  // and lp; the argument of each term then follows by angle addition
+  double sin_d[kMultipleCount]{}, cos_d[kMultipleCount]{};
+  double sin_m[kMultipleCount]{}, cos_m[kMultipleCount]{};
+  double sin_mp[kMultipleCount]{}, cos_mp[kMultipleCount]{};
+  double sin_f[kMultipleCount]{}, cos_f[kMultipleCount]{};
+  sin_cos_multiples<kMaxMultiple>(d, sin_d, cos_d);
+  sin_cos_multiples<kMaxMultiple>(m, sin_m, cos_m);
+  sin_cos_multiples<kMaxMultiple>(mp, sin_mp, cos_mp);
+  sin_cos_multiples<kMaxMultiple>(f, sin_f, cos_f);
+  auto sin_cos_arg{[&](int kd, int km, int kmp, int kf, double* p_sin,
+                       double* p_cos) {
+    int i{kd + kMaxMultiple}, j{km + kMaxMultiple};
+    int k{kmp + kMaxMultiple}, l{kf + kMaxMultiple};
+    double sin_arg{sin_d[i] * cos_m[j] + cos_d[i] * sin_m[j]};
+    double cos_arg{cos_d[i] * cos_m[j] - sin_d[i] * sin_m[j]};
+    double sin_arg2{sin_arg * cos_mp[k] + cos_arg * sin_mp[k]};
+    double cos_arg2{cos_arg * cos_mp[k] - sin_arg * sin_mp[k]};
+    *p_sin = sin_arg2 * cos_f[l] + cos_arg2 * sin_f[l];
+    if (p_cos) *p_cos = cos_arg2 * cos_f[l] - sin_arg2 * sin_f[l];
+  }};
+  double sin_a1{0.0}, cos_a1{0.0}, sin_lp{0.0}, cos_lp{0.0};
+  SIMD::SinCos(a1, &sin_a1, &cos_a1);
+  SIMD::SinCos(lp, &sin_lp, &cos_lp);
+  const int one{kMaxMultiple + 1};
+
+  double sum_l{3958_deg * sin_a1 +
+               1962_deg * (sin_lp * cos_f[one] - cos_lp * sin_f[one]) +
+               318_deg * SIMD::Sin(a2)};
   double sum_r{385000560.0};
-  for (auto& pt : periodic_terms_lr) {
-    double arg{pt.d * d + pt.m * m + pt.mp * mp + pt.f * f};
-    sum_l += es[pt.m] * pt.l * std::sin(arg);
-    sum_r += es[pt.m] * pt.r * std::cos(arg);
+  const TermsLR& lr{kTermsLR};
+  for (int j = 0; j < kTermCount; j++) {
+    double sin_arg{0.0}, cos_arg{0.0};
+    sin_cos_arg(lr.d[j], lr.m[j], lr.mp[j], lr.f[j], &sin_arg, &cos_arg);
+    sum_l += es[lr.m[j]] * lr.l[j] * sin_arg;
+    sum_r += es[lr.m[j]] * lr.r[j] * cos_arg;
   }
-  double sum_b{-2235_deg * std::sin(lp) + 382_deg * std::sin(a3) +
-               175_deg * std::sin(a1 - f) + 175_deg * std::sin(a1 + f) +
-               127_deg * std::sin(lp - mp) - 115_deg * std::sin(lp + mp)};
-  for (auto& pt : periodic_terms_b) {
-    double arg{pt.d * d + pt.m * m + pt.mp * mp + pt.f * f};
-    sum_b += es[pt.m] * pt.b * std::sin(arg);
+  // sin(a1 - f) + sin(a1 + f) = 2 sin(a1) cos(f), and
+  // 127" sin(lp - mp) - 115" sin(lp + mp) expanded likewise
+  double sum_b{-2235_deg * sin_lp + 382_deg * SIMD::Sin(a3) +
+               175_deg * 2.0 * sin_a1 * cos_f[one] +
+               (127_deg - 115_deg) * sin_lp * cos_mp[one] -
+               (127_deg + 115_deg) * cos_lp * sin_mp[one]};
+  const TermsB& tb{kTermsB};
+  for (int j = 0; j < kTermCount; j++) {
+    double sin_arg{0.0};
+    sin_cos_arg(tb.d[j], tb.m[j], tb.mp[j], tb.f[j], &sin_arg, nullptr);
+    sum_b += es[tb.m[j]] * tb.b[j] * sin_arg;
   }
 
   if (p_longitude) *p_longitude = RadUnwind(lp + sum_l / 1000000.0);
@@ -190,6 +247,182 @@ constexpr void ELP82JM::Compute(double tt, double* p_longitude,
   if (p_radius_vector_km) *p_radius_vector_km = sum_r / 1000.0;
 }
 
+inline void ELP82JM::Compute(std::span<const double> tts,
+                             std::span<double> longitudes,
+                             std::span<double> latitudes,
+                             std::span<double> radius_vectors_km,
+                             std::span<double> longitude_rates,
+                             std::span<double> latitude_rates,
+                             std::span<double> radius_vector_km_rates) {
+  std::span<double> outputs[]{longitudes,      latitudes,
+                              radius_vectors_km, longitude_rates,
+                              latitude_rates,  radius_vector_km_rates};
+  double* pointers[6];
+  for (int o = 0; o < 6; o++) {
+    assert(outputs[o].empty() || outputs[o].size() == tts.size());
+    pointers[o] = outputs[o].empty() ? nullptr : outputs[o].data();
+  }
+  SIMD::GetKernels().elp82jm_positions(tts.data(), static_cast<int>(tts.size()),
+                                       pointers);
+  for (double& longitude : longitudes) longitude = RadUnwind(longitude);
+  for (double& latitude : latitudes) latitude = RadNormalize(latitude);
+}
+
+inline void ELP82JM::Compute(ThreadPool& pool, std::span<const double> tts,
+                             std::span<double> longitudes,
+                             std::span<double> latitudes,
+                             std::span<double> radius_vectors_km) {
+  pool.ParallelFor(tts.size(), [&](std::size_t begin, std::size_t end) {
+    auto chunk{[&](std::span<double> outputs) {
+      return outputs.empty() ? outputs : outputs.subspan(begin, end - begin);
+    }};
+    Compute(tts.subspan(begin, end - begin), chunk(longitudes),
+            chunk(latitudes), chunk(radius_vectors_km));
+  });
+}
+
+namespace SIMD {
+inline namespace PA_SIMD_ISA {
+
+// ELP82JM::Compute() at an epoch per lane, with the rates
+// - outputs: Longitude (not reduced to [0, 2 pi)), latitude (not normalized),
+//   radius vector (km), then their rates per day
+// - Only code of this namespace (see simd_kernels.cpp)
+inline void ComputeELP82JM(VecD tt, VecD* outputs) noexcept {
+  constexpr int kMax{ELP82JM::kMaxMultiple};
+  constexpr int kCount{ELP82JM::kMultipleCount};
+  VecD t{(tt - EpochJ2000) / 36525.0};
+  // Value and derivative w.r.t. t of a polynomial, by Horner's rule
+  auto polynomial{[&t](const auto& c, VecD* p_rate) {
+    constexpr int n{sizeof(c) / sizeof(c[0])};
+    VecD value{Broadcast(c[n - 1])};
+    VecD rate{Broadcast((n - 1) * c[n - 1])};
+    for (int k = n - 2; k >= 0; k--) {
+      value = value * t + c[k];
+      if (k > 0) rate = rate * t + k * c[k];
+    }
+    *p_rate = rate;
+    return value;
+  }};
+  VecD lp_rate, d_rate, m_rate, mp_rate, f_rate, a1_rate, a2_rate, a3_rate,
+      e_rate;
+  VecD lp{polynomial(ELP82JM::kMeanLongitude, &lp_rate)};
+  VecD d{polynomial(ELP82JM::kMeanElongation, &d_rate)};
+  VecD m{polynomial(ELP82JM::kSunMeanAnomaly, &m_rate)};
+  VecD mp{polynomial(ELP82JM::kMoonMeanAnomaly, &mp_rate)};
+  VecD f{polynomial(ELP82JM::kArgumentOfLatitude, &f_rate)};
+  VecD a1{polynomial(ELP82JM::kA1, &a1_rate)};
+  VecD a2{polynomial(ELP82JM::kA2, &a2_rate)};
+  VecD a3{polynomial(ELP82JM::kA3, &a3_rate)};
+  VecD e{polynomial(ELP82JM::kEccentricity, &e_rate)};
+  VecD es_internal[]{e * e, e, Broadcast(1.0), e, e * e};
+  VecD es_rate_internal[]{2.0 * e * e_rate, e_rate, VecD{}, e_rate,
+                          2.0 * e * e_rate};
+  VecD* es{es_internal + 2};
+  VecD* es_rate{es_rate_internal + 2};
+
+  // Multiples of the arguments (see sin_cos_multiples())
+  VecD sin_d[kCount], cos_d[kCount], sin_m[kCount], cos_m[kCount];
+  VecD sin_mp[kCount], cos_mp[kCount], sin_f[kCount], cos_f[kCount];
+  SinCosMultiples<kMax>(d, sin_d, cos_d);
+  SinCosMultiples<kMax>(m, sin_m, cos_m);
+  SinCosMultiples<kMax>(mp, sin_mp, cos_mp);
+  SinCosMultiples<kMax>(f, sin_f, cos_f);
+  // sin and cos of the argument of a term, and its rate
+  auto sin_cos_arg{[&](int kd, int km, int kmp, int kf, VecD* p_sin,
+                       VecD* p_cos) {
+    int i{kd + kMax}, j{km + kMax}, k{kmp + kMax}, l{kf + kMax};
+    VecD sin_arg{sin_d[i] * cos_m[j] + cos_d[i] * sin_m[j]};
+    VecD cos_arg{cos_d[i] * cos_m[j] - sin_d[i] * sin_m[j]};
+    VecD sin_arg2{sin_arg * cos_mp[k] + cos_arg * sin_mp[k]};
+    VecD cos_arg2{cos_arg * cos_mp[k] - sin_arg * sin_mp[k]};
+    *p_sin = sin_arg2 * cos_f[l] + cos_arg2 * sin_f[l];
+    *p_cos = cos_arg2 * cos_f[l] - sin_arg2 * sin_f[l];
+    return static_cast<double>(kd) * d_rate + static_cast<double>(km) * m_rate +
+           static_cast<double>(kmp) * mp_rate +
+           static_cast<double>(kf) * f_rate;
+  }};
+  VecD sin_a1, cos_a1, sin_a2, cos_a2, sin_a3, cos_a3, sin_lp, cos_lp;
+  SinCos(a1, &sin_a1, &cos_a1);
+  SinCos(a2, &sin_a2, &cos_a2);
+  SinCos(a3, &sin_a3, &cos_a3);
+  SinCos(lp, &sin_lp, &cos_lp);
+  const int one{kMax + 1};
+
+  VecD sum_l{3958_deg * sin_a1 +
+             1962_deg * (sin_lp * cos_f[one] - cos_lp * sin_f[one]) +
+             318_deg * sin_a2};
+  VecD sum_l_rate{3958_deg * cos_a1 * a1_rate +
+                  1962_deg * (cos_lp * cos_f[one] + sin_lp * sin_f[one]) *
+                      (lp_rate - f_rate) +
+                  318_deg * cos_a2 * a2_rate};
+  VecD sum_r{Broadcast(385000560.0)}, sum_r_rate{};
+  const ELP82JM::TermsLR& lr{ELP82JM::kTermsLR};
+  for (int j = 0; j < ELP82JM::kTermCount; j++) {
+    VecD sin_arg, cos_arg;
+    VecD arg_rate{
+        sin_cos_arg(lr.d[j], lr.m[j], lr.mp[j], lr.f[j], &sin_arg, &cos_arg)};
+    VecD factor{es[lr.m[j]]}, factor_rate{es_rate[lr.m[j]]};
+    sum_l += factor * lr.l[j] * sin_arg;
+    sum_l_rate +=
+        lr.l[j] * (factor_rate * sin_arg + factor * cos_arg * arg_rate);
+    sum_r += factor * lr.r[j] * cos_arg;
+    sum_r_rate +=
+        lr.r[j] * (factor_rate * cos_arg - factor * sin_arg * arg_rate);
+  }
+  VecD sum_b{-2235_deg * sin_lp + 382_deg * sin_a3 +
+             175_deg * 2.0 * sin_a1 * cos_f[one] +
+             (127_deg - 115_deg) * sin_lp * cos_mp[one] -
+             (127_deg + 115_deg) * cos_lp * sin_mp[one]};
+  VecD sum_b_rate{
+      -2235_deg * cos_lp * lp_rate + 382_deg * cos_a3 * a3_rate +
+      175_deg * 2.0 *
+          (cos_a1 * cos_f[one] * a1_rate - sin_a1 * sin_f[one] * f_rate) +
+      (127_deg - 115_deg) *
+          (cos_lp * cos_mp[one] * lp_rate - sin_lp * sin_mp[one] * mp_rate) -
+      (127_deg + 115_deg) *
+          (cos_lp * cos_mp[one] * mp_rate - sin_lp * sin_mp[one] * lp_rate)};
+  const ELP82JM::TermsB& tb{ELP82JM::kTermsB};
+  for (int j = 0; j < ELP82JM::kTermCount; j++) {
+    VecD sin_arg, cos_arg;
+    VecD arg_rate{
+        sin_cos_arg(tb.d[j], tb.m[j], tb.mp[j], tb.f[j], &sin_arg, &cos_arg)};
+    VecD factor{es[tb.m[j]]}, factor_rate{es_rate[tb.m[j]]};
+    sum_b += factor * tb.b[j] * sin_arg;
+    sum_b_rate +=
+        tb.b[j] * (factor_rate * sin_arg + factor * cos_arg * arg_rate);
+  }
+
+  // Per century to per day
+  outputs[0] = lp + sum_l / 1000000.0;
+  outputs[1] = sum_b / 1000000.0;
+  outputs[2] = sum_r / 1000.0;
+  outputs[3] = (lp_rate + sum_l_rate / 1000000.0) / 36525.0;
+  outputs[4] = sum_b_rate / 1000000.0 / 36525.0;
+  outputs[5] = sum_r_rate / 1000.0 / 36525.0;
+}
+
+// Over size epochs; outputs[6] as above, each skipped if nullptr
+inline void ComputeELP82JM(const double* tts, int size,
+                           double* const* outputs) noexcept {
+  for (int i = 0; i < size; i += kWidth) {
+    int count{size - i < kWidth ? size - i : kWidth};
+    // Lanes past the end repeat the first epoch
+    VecD tt{Broadcast(tts[i])};
+    for (int lane = 0; lane < count; lane++) tt[lane] = tts[i + lane];
+    VecD values[6];
+    ComputeELP82JM(tt, values);
+    for (int o = 0; o < 6; o++) {
+      if (!outputs[o]) continue;
+      for (int lane = 0; lane < count; lane++) {
+        outputs[o][i + lane] = values[o][lane];
+      }
+    }
+  }
+}
+
+}  // namespace PA_SIMD_ISA
+}  // namespace SIMD
 }  // namespace PA
 
 #endif  // ELP82JM_H_
@@ -0,0 +1,77 @@
+#ifndef FFT_H_
+#define FFT_H_
+
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace PA {
+
+// Radix-2 complex FFT of a fixed power-of-two size
+// - Forward: X[k] = sum(x[m] * exp(-2 pi i k m / size)), unnormalized;
+//   inverse with exp(+2 pi i k m / size)
+// - Twiddle factors computed once, each directly from its angle, so that the
+//   rounding errors grow with log2(size) only
+class FFT {
+ public:
+  explicit inline FFT(int size);
+
+  int GetSize() const noexcept { return size_; }
+  inline void Transform(std::span<std::complex<double>> data,
+                        bool inverse = false) const noexcept;
+
+ private:
+  int size_;
+  std::vector<std::complex<double>> twiddles_;  // exp(-2 pi i k / size)
+  std::vector<int> bit_reversal_;
+};
+
+inline FFT::FFT(int size) : size_(size) {
+  assert(size > 0 && (size & (size - 1)) == 0);
+  twiddles_.resize(size / 2);
+  for (int k = 0; k < size / 2; k++) {
+    double angle{-2.0 * M_PI * k / size};
+    twiddles_[k] = {std::cos(angle), std::sin(angle)};
+  }
+  bit_reversal_.resize(size);
+  int bits{0};
+  while ((1 << bits) < size) bits++;
+  for (int i = 0; i < size; i++) {
+    int reversed{0};
+    for (int b = 0; b < bits; b++) reversed |= ((i >> b) & 1) << (bits - 1 - b);
+    bit_reversal_[i] = reversed;
+  }
+}
+
+inline void FFT::Transform(std::span<std::complex<double>> data,
+                           bool inverse) const noexcept {
+  assert(static_cast<int>(data.size()) == size_);
+  for (int i = 0; i < size_; i++) {
+    if (i < bit_reversal_[i]) std::swap(data[i], data[bit_reversal_[i]]);
+  }
+  for (int half = 1; half < size_; half *= 2) {
+    int stride{size_ / (2 * half)};
+    for (int begin = 0; begin < size_; begin += 2 * half) {
+      for (int k = 0; k < half; k++) {
+        // Written out, as std::complex multiplication checks for NaNs
+        const std::complex<double> &w{twiddles_[k * stride]};
+        double w_im{inverse ? -w.imag() : w.imag()};
+        std::complex<double> &p_u{data[begin + k]};
+        std::complex<double> &p_v{data[begin + k + half]};
+        double v_re{p_v.real() * w.real() - p_v.imag() * w_im};
+        double v_im{p_v.real() * w_im + p_v.imag() * w.real()};
+        double u_re{p_u.real()};
+        double u_im{p_u.imag()};
+        p_u = {u_re + v_re, u_im + v_im};
+        p_v = {u_re - v_re, u_im - v_im};
+      }
+    }
+  }
+}
+
+}  // namespace PA
+
+#endif  // FFT_H_
@@ -0,0 +1,154 @@
+#ifndef MERGED_PERIODIC_SERIES_H_
+#define MERGED_PERIODIC_SERIES_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "simd.h"
+#include "simd_dispatch.h"
+#include "utils.h"
+
+namespace PA {
+
+// Several PeriodicTermTables (e.g. L, B and R of a planet) merged into one
+// contiguous structure-of-arrays table, evaluated in a single pass
+// - Blocks: one per (table, degree), each with its amplitude (a), phase (b)
+//   and frequency (c) arrays zero-padded to whole vectors of any ISA, laid out
+//   one after the other in a single aligned allocation
+// - Evaluated with the kernels of the host ISA (see simd_dispatch.h)
+// - The powers of t are computed once and shared by all the tables, instead of
+//   a Horner recurrence per table
+class MergedPeriodicSeries {
+ public:
+  static constexpr std::size_t kAlignment{64};
+
+  explicit MergedPeriodicSeries(
+      std::initializer_list<const PeriodicTermTable *> tables);
+
+  int GetTableCount() const noexcept { return table_count_; }
+
+  // values[k] = PeriodicTermCompute(tables[k], t)
+  // - Accuracy: Same as PeriodicTermComputeSIMD() (see utils.h)
+  inline void Compute(double t, double *values) const noexcept;
+  // Same, with rates[k] = d values[k] / dt from the same sin/cos of each term
+  // (see PeriodicTermComputeWithRateScalar() in utils.h)
+  inline void Compute(double t, double *values, double *rates) const noexcept;
+
+ private:
+  struct Block {
+    std::size_t offset;  // Of a; b and c follow at offset + k * size
+    int size;            // Padded to whole vectors of any ISA
+    int table;
+    int degree;
+    PeriodicTermTable::Method method;
+  };
+
+  struct AlignedDelete {
+    void operator()(double *p) const noexcept {
+      ::operator delete[](p, std::align_val_t{kAlignment});
+    }
+  };
+
+  static constexpr int kMaxDegreeCount{8};
+
+  int table_count_{0};
+  int degree_count_{0};
+  std::unique_ptr<double[], AlignedDelete> storage_;
+  std::vector<Block> blocks_;
+};
+
+inline MergedPeriodicSeries::MergedPeriodicSeries(
+    std::initializer_list<const PeriodicTermTable *> tables) {
+  using SIMD::kMaxWidth;
+  std::size_t storage_size{0};
+  for (const PeriodicTermTable *table : tables) {
+    for (int degree = 0; degree < table->size; degree++) {
+      int size{(table->degrees[degree].size + kMaxWidth - 1) / kMaxWidth *
+               kMaxWidth};
+      if (size == 0) continue;
+      blocks_.push_back(Block{storage_size, size, table_count_, degree,
+                              table->method});
+      storage_size += 3 * size;
+    }
+    degree_count_ = std::max(degree_count_, table->size);
+    assert(degree_count_ <= kMaxDegreeCount);
+    table_count_++;
+  }
+  storage_.reset(static_cast<double *>(::operator new[](
+      (storage_size > 0 ? storage_size : 1) * sizeof(double),
+      std::align_val_t{kAlignment})));
+
+  for (const Block &block : blocks_) {
+    const PeriodicTermTableDegree &table_degree{
+        tables.begin()[block.table]->degrees[block.degree]};
+    double *a{storage_.get() + block.offset};
+    double *b{a + block.size};
+    double *c{b + block.size};
+    for (int i = 0; i < block.size; i++) {
+      bool is_term{i < table_degree.size};
+      a[i] = is_term ? table_degree.terms[i].a : 0.0;
+      b[i] = is_term ? table_degree.terms[i].b : 0.0;
+      c[i] = is_term ? table_degree.terms[i].c : 0.0;
+    }
+  }
+}
+
+inline void MergedPeriodicSeries::Compute(double t,
+                                          double *values) const noexcept {
+  const SIMD::Kernels &kernels{SIMD::GetKernels()};
+  double t_powers[kMaxDegreeCount];
+  t_powers[0] = 1.0;
+  for (int degree = 1; degree < degree_count_; degree++) {
+    t_powers[degree] = t_powers[degree - 1] * t;
+  }
+  for (int k = 0; k < table_count_; k++) values[k] = 0.0;
+
+  for (const Block &block : blocks_) {
+    const double *a{storage_.get() + block.offset};
+    const double *b{a + block.size};
+    const double *c{b + block.size};
+    values[block.table] +=
+        t_powers[block.degree] *
+        kernels.series_sums[static_cast<int>(block.method)](a, b, c,
+                                                            block.size, t);
+  }
+}
+
+inline void MergedPeriodicSeries::Compute(double t, double *values,
+                                          double *rates) const noexcept {
+  const SIMD::Kernels &kernels{SIMD::GetKernels()};
+  double t_powers[kMaxDegreeCount];
+  t_powers[0] = 1.0;
+  for (int degree = 1; degree < degree_count_; degree++) {
+    t_powers[degree] = t_powers[degree - 1] * t;
+  }
+  for (int k = 0; k < table_count_; k++) {
+    values[k] = 0.0;
+    rates[k] = 0.0;
+  }
+
+  for (const Block &block : blocks_) {
+    const double *a{storage_.get() + block.offset};
+    const double *b{a + block.size};
+    const double *c{b + block.size};
+    double degree_sum, rate_sum;
+    kernels.series_sums_with_rate[static_cast<int>(block.method)](
+        a, b, c, block.size, t, &degree_sum, &rate_sum);
+    // d/dt [t^d S(t)] = d t^(d-1) S(t) + t^d S'(t)
+    values[block.table] += t_powers[block.degree] * degree_sum;
+    rates[block.table] += t_powers[block.degree] * rate_sum;
+    if (block.degree > 0) {
+      rates[block.table] +=
+          block.degree * t_powers[block.degree - 1] * degree_sum;
+    }
+  }
+}
+
+}  // namespace PA
+
+#endif  // MERGED_PERIODIC_SERIES_H_
@@ -0,0 +1,108 @@
+#include "nutation_table.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <iterator>
+
+#include "date.h"
+#include "earth_nutation.h"
+
+using namespace PA;
+
+namespace {
+
+// Bound of max|f''''| (radians per day^4) over |t| <= t_max, for f the sums of
+// the series (0: longitude, 1: obliquity)
+// - For a term (a + b t) sin(arg), or cos: |a + b t| w^4 + 4 |b'| w^3, w being
+//   a bound of |d arg / dtt| and b' = d(b t) / dtt; the terms with
+//   d^2 arg / dtt^2 are below 1e-10 of these, which the margin of 1% covers
+// - Also returns sum(|amplitude|), the scale of the rounding errors
+void BoundFourthDerivatives(double t_max, double *bounds, double *magnitudes) {
+  const auto &terms{EarthNutation::kTermsIAU2000B};
+  const auto &arguments{EarthNutation::kArgumentsIAU2000B};
+  constexpr int kDegreeCount{
+      std::size(EarthNutation::kArgumentsIAU2000B[0])};
+  double argument_rates[EarthNutation::kArgumentCount]{};
+  for (int a = 0; a < EarthNutation::kArgumentCount; a++) {
+    double t_power{1.0};
+    for (int k = 1; k < kDegreeCount; k++) {
+      argument_rates[a] += k * std::fabs(arguments[a][k]) * t_power / 36525.0;
+      t_power *= t_max;
+    }
+  }
+
+  for (int o = 0; o < 2; o++) bounds[o] = magnitudes[o] = 0.0;
+  for (std::size_t i = 0; i < std::size(terms.psi_sin); i++) {
+    double w{0.0};
+    for (int a = 0; a < EarthNutation::kArgumentCount; a++) {
+      w += std::abs(terms.multipliers[a][i]) * argument_rates[a];
+    }
+    double w3{w * w * w};
+    double amplitudes[]{
+        std::fabs(terms.psi_sin[i]) + std::fabs(terms.psi_t_sin[i]) * t_max +
+            std::fabs(terms.psi_cos[i]),
+        std::fabs(terms.eps_cos[i]) + std::fabs(terms.eps_t_cos[i]) * t_max +
+            std::fabs(terms.eps_sin[i])};
+    double t_rates[]{std::fabs(terms.psi_t_sin[i]) / 36525.0,
+                     std::fabs(terms.eps_t_cos[i]) / 36525.0};
+    for (int o = 0; o < 2; o++) {
+      bounds[o] += (amplitudes[o] * w3 * w + 4.0 * t_rates[o] * w3) /
+                   terms.divisor;
+      magnitudes[o] += amplitudes[o] / terms.divisor;
+    }
+  }
+}
+
+}  // namespace
+
+NutationTable NutationTable::Build(double tt_begin, double tt_end,
+                                   double step_days) {
+  NutationTable table;
+  if (!(step_days > 0.0) || !(tt_end >= tt_begin)) return table;
+  table.tt_begin_ = tt_begin;
+  table.tt_end_ = tt_end;
+  table.step_days_ = step_days;
+  int interval_count{std::max(
+      1, static_cast<int>(std::ceil((tt_end - tt_begin) / step_days)))};
+  table.node_count_ = interval_count + 3;
+
+  std::vector<double> tts(table.node_count_);
+  for (int k = 0; k < table.node_count_; k++) {
+    tts[k] = tt_begin + (k - 1) * step_days;
+  }
+  table.longitudes_.resize(table.node_count_);
+  table.obliquities_.resize(table.node_count_);
+  EarthNutation::ComputeNutationIAU2000B(tts, table.longitudes_,
+                                         table.obliquities_);
+
+  double t_max{std::max(std::fabs(tts.front() - EpochJ2000),
+                        std::fabs(tts.back() - EpochJ2000)) /
+               36525.0};
+  double bounds[2], magnitudes[2];
+  BoundFourthDerivatives(t_max, bounds, magnitudes);
+  double h4{std::pow(step_days, 4)};
+  for (int o = 0; o < 2; o++) {
+    // Rounding: Of the series and of the four weighted nodes
+    double bound{1.01 * 3.0 / 128.0 * h4 * bounds[o] +
+                 16.0 * DBL_EPSILON * magnitudes[o]};
+    table.error_bound_ = std::max(table.error_bound_, bound);
+  }
+
+  // Check at the middle of the intervals, where the error peaks
+  std::vector<double> middles;
+  for (int k = 0; k < interval_count; k++) {
+    double tt{tt_begin + (k + 0.5) * step_days};
+    if (tt <= tt_end) middles.push_back(tt);
+  }
+  std::vector<double> longitudes(middles.size()), obliquities(middles.size());
+  EarthNutation::ComputeNutationIAU2000B(middles, longitudes, obliquities);
+  for (std::size_t i = 0; i < middles.size(); i++) {
+    double longitude{0.0}, obliquity{0.0};
+    table.Compute(middles[i], &longitude, &obliquity);
+    table.max_error_ = std::max({table.max_error_,
+                                 std::fabs(longitude - longitudes[i]),
+                                 std::fabs(obliquity - obliquities[i])});
+  }
+  return table;
+}
@@ -1,14 +1,20 @@
 #ifndef OBSERVER_H_
 #define OBSERVER_H_
 
+#include <cassert>
+#include <span>
 #include <string>
+#include <vector>
 
+#include "chebyshev_ephemeris.h"
 #include "coordinate.h"
 #include "earth_nutation.h"
 #include "earth_obliquity.h"
 #include "elp82jm.h"
 #include "misc.h"
+#include "nutation_table.h"
 #include "sun.h"
+#include "thread_pool.h"
 #include "vsop87.h"
 
 namespace PA {
@@ -80,11 +86,22 @@ class Observer {
     kIAU1980MeeusTruncated,
     kIAU1980,
     kIAU2000B,
+    kInterpolated,  // IAU 2000B from the table of SetNutationTable()
   };
   constexpr void SetNutationAlgorithm(NutationAlgorithm algorithm) noexcept;
+  // Table of NutationAlgorithm::kInterpolated (nullptr: none), not owned; the
+  // series IAU 2000B is evaluated at the epochs it does not cover
+  constexpr void SetNutationTable(const NutationTable *table) noexcept;
   constexpr double GetNutationLongitude() const noexcept;
   constexpr double GetNutationObliquity() const noexcept;
 
+  /* Planetary Theory */
+
+  constexpr void SetVSOP87Accuracy(VSOP87::Accuracy accuracy) noexcept;
+  // Precomputed ephemeris used instead of the theories within its coverage
+  // (nullptr: none), not owned
+  constexpr void SetEphemeris(const ChebyshevEphemeris *ephemeris) noexcept;
+
   /* Obliquity */
 
   constexpr double GetObliquityMean() const noexcept;
@@ -111,12 +128,42 @@ class Observer {
   constexpr double GetApparentRightAscension(Body body) const noexcept;
   constexpr double GetApparentDeclination(Body body) const noexcept;
 
+  /* Batch Computation
+   * - Values at each of the epochs tts, with the settings of this observer
+   *   (nutation algorithm, VSOP87 accuracy, ephemeris), on the threads of a
+   *   pool (see ThreadPool)
+   * - Outputs are skipped when their span is empty, otherwise they must have
+   *   the size of tts (times that of bodies)
+   */
+
+  inline void ComputeNutation(ThreadPool &pool, std::span<const double> tts,
+                              std::span<double> longitudes,
+                              std::span<double> obliquities) const;
+  inline void ComputeApparentPositions(ThreadPool &pool,
+                                       std::span<const double> tts, Body body,
+                                       std::span<double> longitudes,
+                                       std::span<double> latitudes) const;
+  // Outputs of bodies[k] at [k * tts.size(), (k + 1) * tts.size()); the
+  // epochs are split by the estimated cost of each body (see
+  // GetEstimatedTermCount())
+  inline void ComputeApparentPositions(ThreadPool &pool,
+                                       std::span<const double> tts,
+                                       std::span<const Body> bodies,
+                                       std::span<double> longitudes,
+                                       std::span<double> latitudes) const;
+
  private:
   double tt_{EpochJ2000};
   // Body observe_{Body::kMax};
 
+  // An observer at tt with the settings of this one
+  constexpr Observer WithSettingsAt(double tt) const noexcept;
+  // Periodic terms evaluated for the apparent position of a body
+  inline double GetEstimatedTermCount(Body body) const noexcept;
+
   constexpr void ComputeNutation() const noexcept;
   NutationAlgorithm nutation_algorithm_{NutationAlgorithm::kIAU2000B};
+  const NutationTable *nutation_table_{nullptr};
   mutable bool nutation_is_valid_{false};
   mutable double nutation_longitude_{0.0};
   mutable double nutation_obliquity_{0.0};
@@ -126,6 +173,14 @@ class Observer {
   mutable double obliquity_mean_{0.0};
   mutable double obliquity_{0.0};
 
+  VSOP87::Accuracy vsop87_accuracy_{VSOP87::Accuracy::kFull};
+  const ChebyshevEphemeris *ephemeris_{nullptr};
+  constexpr void InvalidatePositions() const noexcept;
+  // Rate of the heliocentric longitude of the Earth (radians per day), when it
+  // came with the position of the Sun (ephemeris or full VSOP87)
+  mutable bool earth_longitude_rate_is_valid_{false};
+  mutable double earth_longitude_rate_{0.0};
+
   constexpr void ComputePosition(Body body) const noexcept;
 
   constexpr bool LookupBodyPositionIsValid(Body body) const noexcept;
@@ -164,6 +219,14 @@ constexpr void Observer::ComputeNutation() const noexcept {
       EarthNutation::ComputeNutationIAU2000B(tt_, &nutation_longitude_,
                                              &nutation_obliquity_);
       break;
+    case NutationAlgorithm::kInterpolated:
+      if (!nutation_table_ ||
+          !nutation_table_->Compute(tt_, &nutation_longitude_,
+                                    &nutation_obliquity_)) {
+        EarthNutation::ComputeNutationIAU2000B(tt_, &nutation_longitude_,
+                                               &nutation_obliquity_);
+      }
+      break;
   }
   nutation_is_valid_ = true;
 }
@@ -176,6 +239,13 @@ constexpr void Observer::SetNutationAlgorithm(
   }
 }
 
+constexpr void Observer::SetNutationTable(const NutationTable *table) noexcept {
+  if (nutation_table_ != table) {
+    nutation_table_ = table;
+    nutation_is_valid_ = false;
+  }
+}
+
 constexpr double Observer::GetNutationLongitude() const noexcept {
   ComputeNutation();
   return nutation_longitude_;
@@ -186,6 +256,30 @@ constexpr double Observer::GetNutationObliquity() const noexcept {
   return nutation_obliquity_;
 }
 
+/* Planetary Theory */
+
+constexpr void Observer::SetVSOP87Accuracy(VSOP87::Accuracy accuracy) noexcept {
+  if (vsop87_accuracy_ != accuracy) {
+    vsop87_accuracy_ = accuracy;
+    InvalidatePositions();
+  }
+}
+
+constexpr void Observer::SetEphemeris(
+    const ChebyshevEphemeris *ephemeris) noexcept {
+  if (ephemeris_ != ephemeris) {
+    ephemeris_ = ephemeris;
+    InvalidatePositions();
+  }
+}
+
+constexpr void Observer::InvalidatePositions() const noexcept {
+  for (int i = 0; i < static_cast<int>(Body::kMax); i++) {
+    LookupBodyPositionSetIsValid(static_cast<Body>(i), false);
+  }
+  earth_longitude_rate_is_valid_ = false;
+}
+
 /* Obliquity */
 
 constexpr void Observer::ComputeObliquity() const noexcept {
@@ -221,8 +315,27 @@ constexpr void Observer::ComputePosition(Body body) const noexcept {
       // - [Jean99] p.166
       double earth_longitude{0.0}, earth_latitude{0.0},
           earth_radius_vector_au{0.0};
-      VSOP87::Compute(tt_, VSOP87::Planet::kEarth, &earth_longitude,
-                      &earth_latitude, &earth_radius_vector_au);
+      earth_longitude_rate_is_valid_ = false;
+      if (ephemeris_ && ephemeris_->ComputeWithRates(
+                            ChebyshevEphemeris::Body::kEarth, tt_,
+                            &earth_longitude, &earth_latitude,
+                            &earth_radius_vector_au, &earth_longitude_rate_,
+                            nullptr, nullptr)) {
+        earth_longitude_rate_is_valid_ = true;
+      } else {
+        if (vsop87_accuracy_ == VSOP87::Accuracy::kFull) {
+          // The rate comes at little extra cost, from the same sin/cos
+          VSOP87::ComputeWithRates(tt_, VSOP87::Planet::kEarth,
+                                   &earth_longitude, &earth_latitude,
+                                   &earth_radius_vector_au,
+                                   &earth_longitude_rate_, nullptr, nullptr);
+          earth_longitude_rate_is_valid_ = true;
+        } else {
+          VSOP87::Compute(tt_, VSOP87::Planet::kEarth, &earth_longitude,
+                          &earth_latitude, &earth_radius_vector_au,
+                          vsop87_accuracy_);
+        }
+      }
       VSOP87::VSOP87DFrameToFK5(tt_, &earth_longitude, &earth_latitude);
       LookupBodySetLongitude(body, RadUnwind(earth_longitude + M_PI));
       LookupBodySetLatitude(body, -earth_latitude);
@@ -233,8 +346,13 @@ constexpr void Observer::ComputePosition(Body body) const noexcept {
     case Body::kMoon: {
       double moon_longitude{0.0}, moon_latitude{0.0},
           moon_radius_vector_km{0.0};
-      ELP82JM::Compute(tt_, &moon_longitude, &moon_latitude,
-                       &moon_radius_vector_km);
+      if (!ephemeris_ ||
+          !ephemeris_->Compute(ChebyshevEphemeris::Body::kMoon, tt_,
+                               &moon_longitude, &moon_latitude,
+                               &moon_radius_vector_km)) {
+        ELP82JM::Compute(tt_, &moon_longitude, &moon_latitude,
+                         &moon_radius_vector_km);
+      }
       // We removed the light-time correction and moved this to the section for
       // aberration and light-time correction
       // - Reference: [Jean99] p.337
@@ -322,7 +440,19 @@ constexpr double Observer::GetAberrationLongitude(Body body) const noexcept {
       //                            GetTT(), GetGeocentricLongitude(body));
       // [Jean99] p.167
       // Accuracy: < 0".001
-      return -0.005775518 * GetRadiusVectorAU(body) *
+      // - The daily variation of the longitude (w.r.t. a fixed reference
+      //   frame) is the rate of the VSOP87 longitude of the Earth, less that
+      //   of the general precession in longitude ([Jean99] p.136), when the
+      //   rate is available; otherwise it is given by its own series
+      double radius_vector_au{GetRadiusVectorAU(body)};
+      if (earth_longitude_rate_is_valid_) {
+        double t{(GetTT() - EpochJ2000) / 36525.0};
+        double precession_rate{(5029.0966_arcsec + 2.22226_arcsec * t) /
+                               36525.0};
+        return -0.005775518 * radius_vector_au *
+               (earth_longitude_rate_ - precession_rate);
+      }
+      return -0.005775518 * radius_vector_au *
              Sun::GetDailyVariation(GetTT());
     };
 
@@ -390,6 +520,123 @@ constexpr double Observer::GetApparentDeclination(Body body) const noexcept {
       GetApparentLongitude(body), GetApparentLatitude(body), GetObliquity());
 }
 
+/* Batch Computation */
+
+constexpr Observer Observer::WithSettingsAt(double tt) const noexcept {
+  Observer observer{tt};
+  observer.nutation_algorithm_ = nutation_algorithm_;
+  observer.nutation_table_ = nutation_table_;
+  observer.vsop87_accuracy_ = vsop87_accuracy_;
+  observer.ephemeris_ = ephemeris_;
+  return observer;
+}
+
+inline double Observer::GetEstimatedTermCount(Body body) const noexcept {
+  // Terms of the nutation series (the nodes of an interpolation), without a
+  // default so that -Wswitch flags a new NutationAlgorithm
+  double count{0.0};
+  switch (nutation_algorithm_) {
+    case NutationAlgorithm::kIAU1980MeeusTruncated:
+      count = 4.0;
+      break;
+    case NutationAlgorithm::kIAU1980:
+      count = 106.0;
+      break;
+    case NutationAlgorithm::kIAU2000B:
+      count = 77.0;
+      break;
+    case NutationAlgorithm::kInterpolated:
+      count = 4.0;
+      break;
+  }
+  if (body == Body::kMoon) {
+    // Terms of ELP82JM
+    return count + 129.0;
+  }
+  for (int v = 0; v < static_cast<int>(VSOP87::Variable::kMax); v++) {
+    auto variable{static_cast<VSOP87::Variable>(v)};
+    const PeriodicSeries &series{
+        VSOP87::GetSeries(VSOP87::Planet::kEarth, variable)};
+    for (int degree = 0; degree < series.GetDegreeCount(); degree++) {
+      count += vsop87_accuracy_ == VSOP87::Accuracy::kFull
+                   ? series.GetTermCount(degree)
+                   : VSOP87::GetTruncation(VSOP87::Planet::kEarth, variable,
+                                           vsop87_accuracy_)
+                         .term_counts[degree];
+    }
+  }
+  return count;
+}
+
+inline void Observer::ComputeNutation(ThreadPool &pool,
+                                      std::span<const double> tts,
+                                      std::span<double> longitudes,
+                                      std::span<double> obliquities) const {
+  assert(longitudes.empty() || longitudes.size() == tts.size());
+  assert(obliquities.empty() || obliquities.size() == tts.size());
+  pool.ParallelFor(tts.size(), [&](std::size_t begin, std::size_t end) {
+    // The series, an epoch per vector lane (see EarthNutation)
+    auto chunk{[&](std::span<double> outputs) {
+      return outputs.empty() ? outputs : outputs.subspan(begin, end - begin);
+    }};
+    switch (nutation_algorithm_) {
+      case NutationAlgorithm::kIAU1980:
+        EarthNutation::ComputeNutationIAU1980(
+            tts.subspan(begin, end - begin), chunk(longitudes),
+            chunk(obliquities));
+        return;
+      case NutationAlgorithm::kIAU2000B:
+        EarthNutation::ComputeNutationIAU2000B(
+            tts.subspan(begin, end - begin), chunk(longitudes),
+            chunk(obliquities));
+        return;
+      default:
+        break;
+    }
+    for (std::size_t i = begin; i < end; i++) {
+      Observer observer{WithSettingsAt(tts[i])};
+      if (!longitudes.empty()) longitudes[i] = observer.GetNutationLongitude();
+      if (!obliquities.empty()) {
+        obliquities[i] = observer.GetNutationObliquity();
+      }
+    }
+  });
+}
+
+inline void Observer::ComputeApparentPositions(
+    ThreadPool &pool, std::span<const double> tts, Body body,
+    std::span<double> longitudes, std::span<double> latitudes) const {
+  ComputeApparentPositions(pool, tts, std::span<const Body>{&body, 1},
+                           longitudes, latitudes);
+}
+
+inline void Observer::ComputeApparentPositions(
+    ThreadPool &pool, std::span<const double> tts,
+    std::span<const Body> bodies, std::span<double> longitudes,
+    std::span<double> latitudes) const {
+  std::size_t size{tts.size()};
+  assert(longitudes.empty() || longitudes.size() == bodies.size() * size);
+  assert(latitudes.empty() || latitudes.size() == bodies.size() * size);
+  std::vector<double> term_counts;
+  for (Body body : bodies) term_counts.push_back(GetEstimatedTermCount(body));
+  // Items body-major: item = k * size + i
+  pool.ParallelFor(
+      bodies.size() * size,
+      [&](std::size_t begin, std::size_t end) {
+        for (std::size_t item = begin; item < end; item++) {
+          Body body{bodies[item / size]};
+          Observer observer{WithSettingsAt(tts[item % size])};
+          if (!longitudes.empty()) {
+            longitudes[item] = observer.GetApparentLongitude(body);
+          }
+          if (!latitudes.empty()) {
+            latitudes[item] = observer.GetApparentLatitude(body);
+          }
+        }
+      },
+      [&](std::size_t item) { return term_counts[item / size]; });
+}
+
 }  // namespace PA
 
 #endif  // OBSERVER_H_
\ No newline at end of file
@@ -0,0 +1,371 @@
+#ifndef PERIODIC_SERIES_H_
+#define PERIODIC_SERIES_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <vector>
+
+#include "simd.h"
+#include "simd_dispatch.h"
+#include "utils.h"
+
+namespace PA {
+
+// Structure-of-arrays copy of a PeriodicTermTable
+// - Each degree holds separate amplitude (a), phase (b) and frequency (c)
+//   arrays, aligned to a cache line and zero-padded to a multiple of kPadding
+//   terms, so that the kernels use contiguous vector loads and need no tail
+//   loop
+// - Built once from the (generated) PeriodicTermTable, which stays the single
+//   source of the coefficients
+// - The terms of each degree are sorted by decreasing amplitude, so that a
+//   truncated series is a prefix of each degree
+class PeriodicSeries {
+ public:
+  static constexpr std::size_t kAlignment{64};
+  // Lanes of the widest vectors (AVX-512, single precision)
+  static constexpr int kPadding{16};
+
+  // Evaluation restricted to the first term_counts[degree] terms of each
+  // degree
+  // - Worst-case error w.r.t. the full series, for |t| <= t_max:
+  //   error_bound = sum(|a * t_max^degree|) of the dropped terms
+  struct Truncation {
+    std::vector<int> term_counts;
+    double error_bound;
+  };
+
+  // Evaluation of a truncation with the terms of each degree from
+  // float_begins[degree] on in single precision
+  // - float_begins[degree]: A multiple of SIMD::kMaxFloatWidth, or
+  //   truncation.term_counts[degree] for none
+  // - The arguments are reduced in double precision; their sin/cos, the
+  //   products and the sums are then computed with twice the lanes
+  // - Worst-case error w.r.t. the full series in double precision, for
+  //   |t| <= t_max: error_bound, which includes truncation.error_bound (it
+  //   leaves out the rounding errors of the double precision evaluation, see
+  //   Compute(t))
+  struct MixedPrecision {
+    Truncation truncation;
+    std::vector<int> float_begins;
+    double error_bound;
+  };
+
+  explicit PeriodicSeries(const PeriodicTermTable &table);
+
+  inline double Compute(double t) const noexcept;
+  inline double Compute(double t, const Truncation &truncation) const noexcept;
+  inline void Compute(std::span<const double> ts, std::span<double> values,
+                      const Truncation *truncation = nullptr) const noexcept;
+
+  inline double Compute(double t, const MixedPrecision &mixed) const noexcept;
+
+  inline Truncation ComputeTruncation(double tolerance,
+                                      double t_max = 1.0) const;
+  // Half of the tolerance for the truncation, the rest for the terms in single
+  // precision
+  inline MixedPrecision ComputeMixedPrecision(double tolerance,
+                                              double t_max = 1.0) const;
+
+  int GetDegreeCount() const noexcept {
+    return static_cast<int>(degrees_.size());
+  }
+  int GetTermCount(int degree) const noexcept { return degrees_[degree].size; }
+  PeriodicTermTable::Method GetMethod() const noexcept { return method_; }
+
+ private:
+  struct Degree {
+    const double *a;
+    const double *b;
+    const double *c;
+    const float *a_float;
+    int size;
+    int padded_size;
+  };
+
+  struct AlignedDelete {
+    void operator()(double *p) const noexcept {
+      ::operator delete[](p, std::align_val_t{kAlignment});
+    }
+  };
+
+  // Terms to evaluate in a degree: the truncated count rounded up to whole
+  // vectors of any ISA, or all of them
+  inline int GetEvaluatedSize(int degree,
+                              const Truncation *truncation) const noexcept;
+  inline double Compute(double t, const Truncation *truncation) const noexcept;
+
+  // Error bound of a term of a degree in single precision, leaving out the
+  // sums, per unit of |t_max^degree|
+  static inline double GetFloatTermErrorBound(const Degree &degree, int i,
+                                              double t_max) noexcept;
+
+  PeriodicTermTable::Method method_;
+  std::unique_ptr<double[], AlignedDelete> storage_;
+  // Amplitudes in single precision, same layout as those of storage_
+  std::vector<float> float_storage_;
+  std::vector<Degree> degrees_;
+};
+
+inline PeriodicSeries::PeriodicSeries(const PeriodicTermTable &table)
+    : method_(table.method) {
+  std::size_t storage_size{0};
+  for (int degree = 0; degree < table.size; degree++) {
+    int size{table.degrees[degree].size};
+    storage_size += 3 * ((size + kPadding - 1) / kPadding * kPadding);
+  }
+  storage_.reset(static_cast<double *>(::operator new[](
+      (storage_size > 0 ? storage_size : 1) * sizeof(double),
+      std::align_val_t{kAlignment})));
+
+  float_storage_.resize(storage_size / 3);
+
+  double *p{storage_.get()};
+  float *p_float{float_storage_.data()};
+  for (int degree = 0; degree < table.size; degree++) {
+    const PeriodicTermTableDegree &table_degree{table.degrees[degree]};
+    int padded_size{(table_degree.size + kPadding - 1) / kPadding * kPadding};
+    std::vector<PeriodicTerm> terms(table_degree.terms,
+                                    table_degree.terms + table_degree.size);
+    std::stable_sort(terms.begin(), terms.end(),
+                     [](const PeriodicTerm &pt1, const PeriodicTerm &pt2) {
+                       return std::fabs(pt1.a) > std::fabs(pt2.a);
+                     });
+    double *a{p};
+    double *b{a + padded_size};
+    double *c{b + padded_size};
+    for (int i = 0; i < padded_size; i++) {
+      bool is_term{i < table_degree.size};
+      a[i] = is_term ? terms[i].a : 0.0;
+      b[i] = is_term ? terms[i].b : 0.0;
+      c[i] = is_term ? terms[i].c : 0.0;
+      p_float[i] = static_cast<float>(a[i]);
+    }
+    degrees_.push_back(
+        Degree{a, b, c, p_float, table_degree.size, padded_size});
+    p = c + padded_size;
+    p_float += padded_size;
+  }
+}
+
+inline int PeriodicSeries::GetEvaluatedSize(
+    int degree, const Truncation *truncation) const noexcept {
+  if (!truncation) return degrees_[degree].padded_size;
+  return (truncation->term_counts[degree] + SIMD::kMaxWidth - 1) /
+         SIMD::kMaxWidth * SIMD::kMaxWidth;
+}
+
+// With the kernels of the host ISA (see simd_dispatch.h)
+inline double PeriodicSeries::Compute(
+    double t, const Truncation *truncation) const noexcept {
+  const SIMD::Kernels &kernels{SIMD::GetKernels()};
+  auto *series_sum{kernels.series_sums[static_cast<int>(method_)]};
+  double value{0.0};
+  for (int degree = GetDegreeCount() - 1; degree >= 0; degree--) {
+    const Degree &d{degrees_[degree]};
+    int size{GetEvaluatedSize(degree, truncation)};
+    value = value * t + series_sum(d.a, d.b, d.c, size, t);
+  }
+  return value;
+}
+
+// Accuracy: Same as PeriodicTermComputeSIMD() (see utils.h)
+inline double PeriodicSeries::Compute(double t) const noexcept {
+  return Compute(t, nullptr);
+}
+
+// Accuracy: truncation.error_bound, plus that of Compute(t)
+inline double PeriodicSeries::Compute(
+    double t, const Truncation &truncation) const noexcept {
+  return Compute(t, &truncation);
+}
+
+// Drops the terms of smallest weight |a * t_max^degree| across all degrees,
+// as long as the sum of the dropped weights stays within tolerance
+inline PeriodicSeries::Truncation PeriodicSeries::ComputeTruncation(
+    double tolerance, double t_max) const {
+  struct Weight {
+    double weight;
+    int degree;
+  };
+  std::vector<Weight> weights;
+  Truncation truncation{std::vector<int>(GetDegreeCount()), 0.0};
+  double t_power{1.0};
+  for (int degree = 0; degree < GetDegreeCount(); degree++) {
+    const Degree &d{degrees_[degree]};
+    // Walk each degree from its smallest term, so the dropped terms of a
+    // degree always form a suffix
+    for (int i = d.size - 1; i >= 0; i--) {
+      weights.push_back(Weight{std::fabs(d.a[i]) * t_power, degree});
+    }
+    truncation.term_counts[degree] = d.size;
+    t_power *= std::fabs(t_max);
+  }
+  std::stable_sort(weights.begin(), weights.end(),
+                   [](const Weight &w1, const Weight &w2) {
+                     return w1.weight < w2.weight;
+                   });
+  for (const Weight &w : weights) {
+    if (truncation.error_bound + w.weight > tolerance) break;
+    truncation.error_bound += w.weight;
+    truncation.term_counts[w.degree]--;
+  }
+  return truncation;
+}
+
+// Per term of amplitude |a|:
+// - Argument: 3 ulp(|b| + |c| t_max) in double precision (evaluation and
+//   reduction), then rounding to float (ulp_f(pi))
+// - sin/cos: SIMD::kFloatSinCosError
+// - Amplitude rounded to float, and the product: 2 ulp_f(1)
+// The sums within each lane add (terms per lane) ulp_f(1) of sum(|a|), with
+// the lanes of the narrowest vectors (SIMD::kMinFloatWidth)
+inline double PeriodicSeries::GetFloatTermErrorBound(const Degree &degree,
+                                                     int i,
+                                                     double t_max) noexcept {
+  constexpr double kUlp1{0x1.0p-52};
+  constexpr double kUlp1Float{0x1.0p-23};
+  double argument{std::fabs(degree.b[i]) + std::fabs(degree.c[i] * t_max)};
+  return std::fabs(degree.a[i]) *
+         (3.0 * kUlp1 * argument + M_PI * kUlp1Float +
+          SIMD::kFloatSinCosError + 2.0 * kUlp1Float);
+}
+
+// With the kernels of the host ISA (see simd_dispatch.h)
+inline double PeriodicSeries::Compute(
+    double t, const MixedPrecision &mixed) const noexcept {
+  using SIMD::kMaxFloatWidth;
+  using SIMD::kMaxWidth;
+  const SIMD::Kernels &kernels{SIMD::GetKernels()};
+  auto *series_sum{kernels.series_sums[static_cast<int>(method_)]};
+  auto *float_series_sum{kernels.float_series_sums[static_cast<int>(method_)]};
+  double value{0.0};
+  for (int degree = GetDegreeCount() - 1; degree >= 0; degree--) {
+    const Degree &d{degrees_[degree]};
+    int begin{mixed.float_begins[degree]};
+    int count{mixed.truncation.term_counts[degree]};
+    // begin is either count (no term in single precision) or a multiple of
+    // the lanes of any ISA, so that [begin, end) stays within the padding
+    double degree_value{0.0};
+    if (begin < count) {
+      int end{(count + kMaxFloatWidth - 1) / kMaxFloatWidth * kMaxFloatWidth};
+      degree_value = series_sum(d.a, d.b, d.c, begin, t) +
+                     float_series_sum(d.a_float, d.b, d.c, begin, end, t);
+    } else {
+      int end{(count + kMaxWidth - 1) / kMaxWidth * kMaxWidth};
+      degree_value = series_sum(d.a, d.b, d.c, end, t);
+    }
+    value = value * t + degree_value;
+  }
+  return value;
+}
+
+// Moves the terms of smallest weight |a * t_max^degree| (among those kept by
+// the truncation) to single precision, as long as the error bound stays
+// within tolerance
+inline PeriodicSeries::MixedPrecision PeriodicSeries::ComputeMixedPrecision(
+    double tolerance, double t_max) const {
+  MixedPrecision mixed{ComputeTruncation(0.5 * tolerance, t_max),
+                       std::vector<int>(GetDegreeCount()), 0.0};
+  std::vector<double> t_powers(GetDegreeCount());
+  struct Weight {
+    double weight;
+    int degree;
+  };
+  std::vector<Weight> weights;
+  double t_power{1.0};
+  for (int degree = 0; degree < GetDegreeCount(); degree++) {
+    int count{mixed.truncation.term_counts[degree]};
+    for (int i = count - 1; i >= 0; i--) {
+      weights.push_back(Weight{std::fabs(degrees_[degree].a[i]) * t_power,
+                               degree});
+    }
+    mixed.float_begins[degree] = count;
+    t_powers[degree] = t_power;
+    t_power *= std::fabs(t_max);
+  }
+  std::stable_sort(weights.begin(), weights.end(),
+                   [](const Weight &w1, const Weight &w2) {
+                     return w1.weight < w2.weight;
+                   });
+
+  // Bound of the terms [begin, count) of a degree in single precision
+  constexpr double kUlp1Float{0x1.0p-23};
+  std::vector<double> term_bounds(GetDegreeCount(), 0.0);
+  std::vector<double> magnitudes(GetDegreeCount(), 0.0);
+  auto get_degree_bound{[&](int degree, int begin) {
+    int count{mixed.truncation.term_counts[degree]};
+    int terms_per_lane{(count - begin + SIMD::kMinFloatWidth - 1) /
+                       SIMD::kMinFloatWidth};
+    return (term_bounds[degree] +
+            terms_per_lane * kUlp1Float * magnitudes[degree]) *
+           t_powers[degree];
+  }};
+
+  double bound{mixed.truncation.error_bound};
+  for (const Weight &w : weights) {
+    const Degree &d{degrees_[w.degree]};
+    int &begin{mixed.float_begins[w.degree]};
+    double old_degree_bound{get_degree_bound(w.degree, begin)};
+    term_bounds[w.degree] += GetFloatTermErrorBound(d, begin - 1, t_max);
+    magnitudes[w.degree] += std::fabs(d.a[begin - 1]);
+    double new_bound{bound - old_degree_bound +
+                     get_degree_bound(w.degree, begin - 1)};
+    if (new_bound > tolerance) break;
+    bound = new_bound;
+    begin--;
+  }
+
+  // Whole single precision vectors of any ISA: The boundary moves up, so that
+  // the bound can only decrease
+  mixed.error_bound = mixed.truncation.error_bound;
+  for (int degree = 0; degree < GetDegreeCount(); degree++) {
+    int &begin{mixed.float_begins[degree]};
+    int count{mixed.truncation.term_counts[degree]};
+    int rounded{(begin + SIMD::kMaxFloatWidth - 1) / SIMD::kMaxFloatWidth *
+                SIMD::kMaxFloatWidth};
+    begin = std::min(rounded, count);
+    term_bounds[degree] = 0.0;
+    magnitudes[degree] = 0.0;
+    for (int i = begin; i < count; i++) {
+      term_bounds[degree] += GetFloatTermErrorBound(degrees_[degree], i, t_max);
+      magnitudes[degree] += std::fabs(degrees_[degree].a[i]);
+    }
+    mixed.error_bound += get_degree_bound(degree, begin);
+  }
+  return mixed;
+}
+
+// Batch evaluation at the epochs ts: values[i] = Compute(ts[i]) or
+// Compute(ts[i], *truncation)
+// - Blocks of epochs, each degree of a block summed term-major over tiles of
+//   epochs with the kernels of the host ISA (see simd_dispatch.h)
+// - Accuracy: Same as Compute()
+inline void PeriodicSeries::Compute(
+    std::span<const double> ts, std::span<double> values,
+    const Truncation *truncation) const noexcept {
+  constexpr std::size_t kBlockSize{256};
+  const SIMD::Kernels &kernels{SIMD::GetKernels()};
+  auto *series_batch_sum{kernels.series_batch_sums[static_cast<int>(method_)]};
+  for (std::size_t begin = 0; begin < ts.size(); begin += kBlockSize) {
+    int count{static_cast<int>(std::min(kBlockSize, ts.size() - begin))};
+    const double *t{ts.data() + begin};
+    double *value{values.data() + begin};
+    std::fill(value, value + count, 0.0);
+    for (int degree = GetDegreeCount() - 1; degree >= 0; degree--) {
+      const Degree &d{degrees_[degree]};
+      int size{truncation ? truncation->term_counts[degree] : d.size};
+      double sums[kBlockSize];
+      series_batch_sum(d.a, d.b, d.c, size, t, count, sums);
+      for (int k = 0; k < count; k++) value[k] = value[k] * t[k] + sums[k];
+    }
+  }
+}
+
+}  // namespace PA
+
+#endif  // PERIODIC_SERIES_H_
@@ -0,0 +1,229 @@
+#include "periodic_series_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include "periodic_series.h"
+
+using namespace PA;
+
+namespace {
+
+/* File Format */
+
+constexpr char kFileMagic[8]{'P', 'A', 'S', 'E', 'R', 'I', 'E', 'S'};
+constexpr uint32_t kFileVersion{1};
+constexpr uint32_t kFileByteOrder{0x01020304};
+constexpr uint64_t kFileAlignment{64};
+// Terms of a degree are zero-padded to a multiple of it (same as
+// PeriodicSeries)
+constexpr int kFilePadding{PeriodicSeries::kPadding};
+
+struct FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint32_t series_count;
+  uint32_t degree_count;  // Of all series
+};
+
+struct FileSeriesEntry {
+  char name[PeriodicSeriesFile::kMaxNameLength + 1];  // Zero-terminated
+  uint32_t method;  // PeriodicTermTable::Method
+  uint32_t degree_begin;  // Index of its first degree in the degree directory
+  uint32_t degree_count;
+  uint32_t reserved;
+  double epoch;
+  double unit_days;
+  double error_bound;
+};
+
+// The a, b and c arrays of padded_size terms each, from offset
+struct FileDegreeEntry {
+  int32_t size;
+  int32_t padded_size;
+  uint64_t offset;  // From the start of the file
+};
+
+static_assert(sizeof(FileHeader) == 24);
+static_assert(sizeof(FileSeriesEntry) == 72);
+static_assert(sizeof(FileDegreeEntry) == 16);
+
+uint64_t AlignFileOffset(uint64_t offset) {
+  return (offset + kFileAlignment - 1) / kFileAlignment * kFileAlignment;
+}
+
+}  // namespace
+
+bool PeriodicSeriesFile::Save(const std::string &filename,
+                              std::span<const Source> sources) {
+  // Terms of each degree in file order: sorted as in PeriodicSeries, so that
+  // its truncation is a prefix of each degree
+  struct Degree {
+    std::vector<PeriodicTerm> terms;
+    int padded_size;
+  };
+  std::vector<FileSeriesEntry> series_entries;
+  std::vector<FileDegreeEntry> degree_entries;
+  std::vector<Degree> degrees;
+  for (const Source &source : sources) {
+    if (!source.table || source.name.empty() ||
+        source.name.size() > kMaxNameLength || !(source.unit_days > 0.0)) {
+      return false;
+    }
+    for (const FileSeriesEntry &entry : series_entries) {
+      if (source.name == entry.name) return false;
+    }
+    const PeriodicTermTable &table{*source.table};
+    PeriodicSeries::Truncation truncation{
+        PeriodicSeries(table).ComputeTruncation(source.tolerance,
+                                                source.t_max)};
+    FileSeriesEntry entry{};
+    std::memcpy(entry.name, source.name.data(), source.name.size());
+    entry.method = static_cast<uint32_t>(table.method);
+    entry.degree_begin = static_cast<uint32_t>(degrees.size());
+    entry.degree_count = static_cast<uint32_t>(table.size);
+    entry.epoch = source.epoch;
+    entry.unit_days = source.unit_days;
+    entry.error_bound = truncation.error_bound;
+    series_entries.push_back(entry);
+    for (int degree = 0; degree < table.size; degree++) {
+      const PeriodicTermTableDegree &table_degree{table.degrees[degree]};
+      std::vector<PeriodicTerm> terms(table_degree.terms,
+                                      table_degree.terms + table_degree.size);
+      std::stable_sort(terms.begin(), terms.end(),
+                       [](const PeriodicTerm &pt1, const PeriodicTerm &pt2) {
+                         return std::fabs(pt1.a) > std::fabs(pt2.a);
+                       });
+      terms.resize(truncation.term_counts[degree]);
+      int size{static_cast<int>(terms.size())};
+      int padded_size{(size + kFilePadding - 1) / kFilePadding * kFilePadding};
+      degrees.push_back(Degree{std::move(terms), padded_size});
+    }
+  }
+
+  FileHeader header{};
+  std::memcpy(header.magic, kFileMagic, sizeof(kFileMagic));
+  header.version = kFileVersion;
+  header.byte_order = kFileByteOrder;
+  header.series_count = static_cast<uint32_t>(series_entries.size());
+  header.degree_count = static_cast<uint32_t>(degrees.size());
+
+  uint64_t offset{sizeof(header) +
+                  series_entries.size() * sizeof(FileSeriesEntry) +
+                  degrees.size() * sizeof(FileDegreeEntry)};
+  for (const Degree &degree : degrees) {
+    offset = AlignFileOffset(offset);
+    degree_entries.push_back(FileDegreeEntry{
+        .size = static_cast<int32_t>(degree.terms.size()),
+        .padded_size = degree.padded_size,
+        .offset = offset,
+    });
+    offset += 3 * sizeof(double) * degree.padded_size;
+  }
+
+  std::ofstream outfile(filename, std::ios::binary | std::ios::trunc);
+  if (!outfile) return false;
+  outfile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  outfile.write(reinterpret_cast<const char *>(series_entries.data()),
+                series_entries.size() * sizeof(FileSeriesEntry));
+  outfile.write(reinterpret_cast<const char *>(degree_entries.data()),
+                degree_entries.size() * sizeof(FileDegreeEntry));
+  for (std::size_t d = 0; d < degrees.size(); d++) {
+    const Degree &degree{degrees[d]};
+    static const char padding[kFileAlignment]{};
+    outfile.write(padding, degree_entries[d].offset - outfile.tellp());
+    std::vector<double> abc(3 * degree.padded_size, 0.0);
+    for (std::size_t i = 0; i < degree.terms.size(); i++) {
+      abc[i] = degree.terms[i].a;
+      abc[degree.padded_size + i] = degree.terms[i].b;
+      abc[2 * degree.padded_size + i] = degree.terms[i].c;
+    }
+    outfile.write(reinterpret_cast<const char *>(abc.data()),
+                  abc.size() * sizeof(double));
+  }
+  outfile.close();
+  return static_cast<bool>(outfile);
+}
+
+bool PeriodicSeriesFile::Load(const std::string &filename,
+                              PeriodicSeriesFile *p_file) {
+  int fd{open(filename.c_str(), O_RDONLY)};
+  if (fd < 0) return false;
+  struct stat st;
+  if (fstat(fd, &st) != 0 ||
+      st.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+    close(fd);
+    return false;
+  }
+  uint64_t size{static_cast<uint64_t>(st.st_size)};
+  void *address{mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0)};
+  close(fd);
+  if (address == MAP_FAILED) return false;
+  std::shared_ptr<const void> mapping{
+      address, [size](const void *p) { munmap(const_cast<void *>(p), size); }};
+
+  const char *base{static_cast<const char *>(address)};
+  const FileHeader *header{reinterpret_cast<const FileHeader *>(base)};
+  if (std::memcmp(header->magic, kFileMagic, sizeof(kFileMagic)) != 0 ||
+      header->version != kFileVersion ||
+      header->byte_order != kFileByteOrder ||
+      (size - sizeof(FileHeader)) / sizeof(FileSeriesEntry) <
+          header->series_count ||
+      (size - sizeof(FileHeader) -
+       header->series_count * sizeof(FileSeriesEntry)) /
+              sizeof(FileDegreeEntry) <
+          header->degree_count) {
+    return false;
+  }
+
+  PeriodicSeriesFile file;
+  const FileSeriesEntry *series_entries{
+      reinterpret_cast<const FileSeriesEntry *>(base + sizeof(FileHeader))};
+  const FileDegreeEntry *degree_entries{
+      reinterpret_cast<const FileDegreeEntry *>(
+          series_entries + header->series_count)};
+  for (uint32_t s = 0; s < header->series_count; s++) {
+    const FileSeriesEntry &entry{series_entries[s]};
+    if (std::memchr(entry.name, '\0', sizeof(entry.name)) == nullptr ||
+        entry.method > static_cast<uint32_t>(PeriodicTermTable::Method::kCos) ||
+        entry.degree_begin > header->degree_count ||
+        entry.degree_count > header->degree_count - entry.degree_begin) {
+      return false;
+    }
+    Series series;
+    series.name_ = entry.name;
+    series.method_ = static_cast<PeriodicTermTable::Method>(entry.method);
+    series.epoch_ = entry.epoch;
+    series.unit_days_ = entry.unit_days;
+    series.error_bound_ = entry.error_bound;
+    for (uint32_t d = 0; d < entry.degree_count; d++) {
+      const FileDegreeEntry &degree{degree_entries[entry.degree_begin + d]};
+      uint64_t bytes{3 * sizeof(double) *
+                     static_cast<uint64_t>(degree.padded_size)};
+      if (degree.size < 0 || degree.padded_size < degree.size ||
+          degree.padded_size % kFilePadding != 0 ||
+          degree.offset % kFileAlignment != 0 || degree.offset > size ||
+          bytes > size - degree.offset) {
+        return false;
+      }
+      const double *a{reinterpret_cast<const double *>(base + degree.offset)};
+      series.degrees_.push_back(Series::Degree{a, a + degree.padded_size,
+                                               a + 2 * degree.padded_size,
+                                               degree.size,
+                                               degree.padded_size});
+    }
+    file.series_.push_back(std::move(series));
+  }
+  file.mapping_ = std::move(mapping);
+  *p_file = std::move(file);
+  return true;
+}
@@ -0,0 +1,152 @@
+#ifndef PERIODIC_SERIES_FILE_H_
+#define PERIODIC_SERIES_FILE_H_
+
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "simd_dispatch.h"
+#include "utils.h"
+
+namespace PA {
+
+// Periodic series loaded at run time from a binary file, so that a theory
+// (e.g. VSOP2013) or a truncation can change per deployment without
+// regenerating the C++ tables and rebuilding
+// - Each named series is a PeriodicTermTable with its time argument
+//   t = (tt - epoch) / unit_days, in the structure-of-arrays layout of
+//   PeriodicSeries: the terms of each degree sorted by decreasing amplitude,
+//   with a, b and c arrays aligned to a cache line and zero-padded
+// - Load() maps the file read-only and the series are evaluated in place by
+//   the kernels of the host ISA (see simd_dispatch.h); only the pages of the
+//   series in use become resident, and processes loading the same file share
+//   one page-cache copy
+class PeriodicSeriesFile {
+ public:
+  // A series to save: table, truncated to tolerance for |t| <= t_max (see
+  // PeriodicSeries::ComputeTruncation())
+  struct Source {
+    std::string name;
+    const PeriodicTermTable *table;
+    double epoch;
+    double unit_days;
+    double tolerance{0.0};
+    double t_max{1.0};
+  };
+
+  class Series {
+   public:
+    std::string_view GetName() const noexcept { return name_; }
+    PeriodicTermTable::Method GetMethod() const noexcept { return method_; }
+    int GetDegreeCount() const noexcept {
+      return static_cast<int>(degrees_.size());
+    }
+    int GetTermCount(int degree) const noexcept {
+      return degrees_[degree].size;
+    }
+    // Worst-case truncation error w.r.t. the source table, for |t| <= t_max
+    // of the Source
+    double GetErrorBound() const noexcept { return error_bound_; }
+    double GetTime(double tt) const noexcept {
+      return (tt - epoch_) / unit_days_;
+    }
+    double GetUnitDays() const noexcept { return unit_days_; }
+
+    // Accuracy: error_bound, plus that of PeriodicTermComputeSIMD() (see
+    // utils.h)
+    inline double Compute(double t) const noexcept;
+    // Same, with the derivative w.r.t. t from the same sin/cos
+    inline void ComputeWithRate(double t, double *p_value,
+                                double *p_rate) const noexcept;
+
+   private:
+    friend class PeriodicSeriesFile;
+
+    struct Degree {
+      const double *a;
+      const double *b;
+      const double *c;
+      int size;
+      int padded_size;
+    };
+
+    std::string_view name_;
+    PeriodicTermTable::Method method_;
+    double epoch_;
+    double unit_days_;
+    double error_bound_;
+    std::vector<Degree> degrees_;
+  };
+
+  PeriodicSeriesFile() noexcept {}
+  PeriodicSeriesFile(const PeriodicSeriesFile &) = delete;
+  PeriodicSeriesFile &operator=(const PeriodicSeriesFile &) = delete;
+  PeriodicSeriesFile(PeriodicSeriesFile &&) = default;
+  PeriodicSeriesFile &operator=(PeriodicSeriesFile &&) = default;
+
+  // Format (version 1, native byte order): A header, a directory of the
+  // series, a directory of their degrees, then the terms of each degree at
+  // 64-byte aligned offsets (see periodic_series_file.cpp)
+  // - Names: Up to kMaxNameLength characters, unique within a file
+  // - Both return false on failure (I/O error, invalid sources, or not a
+  //   valid file)
+  static constexpr int kMaxNameLength{31};
+  static bool Save(const std::string &filename,
+                   std::span<const Source> sources);
+  static bool Load(const std::string &filename, PeriodicSeriesFile *p_file);
+
+  int GetSeriesCount() const noexcept {
+    return static_cast<int>(series_.size());
+  }
+  const Series &GetSeries(int index) const noexcept { return series_[index]; }
+  // nullptr if there is no series of that name
+  inline const Series *Find(std::string_view name) const noexcept;
+
+ private:
+  std::vector<Series> series_;
+  std::shared_ptr<const void> mapping_;
+};
+
+// With the kernels of the host ISA (see simd_dispatch.h)
+inline double PeriodicSeriesFile::Series::Compute(double t) const noexcept {
+  auto *series_sum{
+      SIMD::GetKernels().series_sums[static_cast<int>(method_)]};
+  double value{0.0};
+  for (int degree = GetDegreeCount() - 1; degree >= 0; degree--) {
+    const Degree &d{degrees_[degree]};
+    value = value * t + series_sum(d.a, d.b, d.c, d.padded_size, t);
+  }
+  return value;
+}
+
+inline void PeriodicSeriesFile::Series::ComputeWithRate(
+    double t, double *p_value, double *p_rate) const noexcept {
+  auto *series_sum_with_rate{
+      SIMD::GetKernels().series_sums_with_rate[static_cast<int>(method_)]};
+  double value{0.0};
+  double rate{0.0};
+  for (int degree = GetDegreeCount() - 1; degree >= 0; degree--) {
+    const Degree &d{degrees_[degree]};
+    double sum, rate_sum;
+    series_sum_with_rate(d.a, d.b, d.c, d.padded_size, t, &sum, &rate_sum);
+    // d/dt (value * t + sum)
+    rate = rate * t + value + rate_sum;
+    value = value * t + sum;
+  }
+  *p_value = value;
+  *p_rate = rate;
+}
+
+inline const PeriodicSeriesFile::Series *PeriodicSeriesFile::Find(
+    std::string_view name) const noexcept {
+  for (const Series &series : series_) {
+    if (series.name_ == name) return &series;
+  }
+  return nullptr;
+}
+
+}  // namespace PA
+
+#endif  // PERIODIC_SERIES_FILE_H_
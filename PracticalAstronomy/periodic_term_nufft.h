@@ -0,0 +1,272 @@
+#ifndef PERIODIC_TERM_NUFFT_H_
+#define PERIODIC_TERM_NUFFT_H_
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <span>
+#include <vector>
+
+#include "fft.h"
+#include "simd.h"
+#include "utils.h"
+
+namespace PA {
+
+// Evaluation of a PeriodicTermTable on the uniform grid t_n = t0 + n * dt with
+// a non-uniform FFT, in O(terms * W + samples * log(N)) instead of
+// O(terms * samples), W the spread width and N the block size
+// - Block size: The smallest power of two that spreads no more grid points per
+//   block than its FFTs hold, so that the terms cost O(1) per sample on top of
+//   the O(log(N)) of the FFTs; N < max(128, 4 W terms), and fewer samples
+//   than that take a single block of O(terms * W + samples * log(samples))
+// - Beyond kMaxBlockSize (for the memory of the grid: 32 bytes per sample),
+//   the terms are spread again for each block, i.e. O(terms * W * samples /
+//   kMaxBlockSize), which the VSOP87 tables are far from (N <= 2^15)
+// - Series with polynomial arguments or per-term factors (ELP82JM) are not
+//   PeriodicTermTables, so they are not covered
+// - On a block of N samples centered at tc, a degree sums
+//   Re or Im of sum(w_j * exp(i n x_j)), w_j = a_j * exp(i (b_j + c_j tc)),
+//   x_j = c_j dt mod 2 pi, n in [-N/2, N/2): a type-1 NUFFT of the frequencies
+//   x_j onto the N samples
+// - Gaussian gridding (Greengard & Lee, SIAM Review 46(3), 2004): each w_j is
+//   spread over 2 * spread_width points of a grid of 2N, which is transformed
+//   by one FFT, then the Gaussian is divided out of each sample
+// - The degrees are evaluated separately, then combined per sample with the
+//   Horner scheme
+// - Accuracy: |error| <= GetErrorBound(t_max) w.r.t.
+//   PeriodicTermComputeScalar() for |t_n| <= t_max, each degree scaled by
+//   t_max^degree: tolerance * sum(|a|) for the gridding, the FFT rounding
+//   errors amplified when the Gaussian is divided out, and
+//   sum(|a| (|b| + 4 |c| t_max)) ulp(1) for the arguments, as
+//   b + c tc + n x_j rounds differently from b + c t_n (like
+//   PeriodicTermComputeSIMDErrorBound(), see utils.h)
+class PeriodicTermNUFFT {
+ public:
+  static constexpr double kDefaultTolerance{1.0e-12};
+  // Below it the FFT rounding errors dominate; smaller tolerances are raised
+  // to it
+  static constexpr double kMinTolerance{1.0e-12};
+  // Largest block size (a power of two)
+  static constexpr int kMaxBlockSize{1 << 20};
+
+  explicit inline PeriodicTermNUFFT(const PeriodicTermTable &table,
+                                    double tolerance = kDefaultTolerance);
+
+  // values[n] = value at t0 + n * dt
+  inline void Compute(double t0, double dt, std::span<double> values) const;
+
+  inline double GetErrorBound(double t_max) const noexcept;
+  int GetSpreadWidth() const noexcept { return spread_width_; }
+  // Of the grids of more samples
+  int GetBlockSize() const noexcept { return block_size_; }
+
+ private:
+  struct Degree {
+    std::vector<double> a, b, c;
+    double magnitude;        // sum(|a|)
+    double phase_magnitude;  // sum(|a * b|)
+    double rate_magnitude;   // sum(|a * c|)
+  };
+
+  // Oversampling of the grid w.r.t. the samples of a block
+  static constexpr int kOversampling{2};
+
+  inline void ComputeBlock(double tc, double dt, const FFT &fft,
+                           std::vector<std::complex<double>> *p_grid,
+                           std::vector<double> *p_sums) const;
+
+  PeriodicTermTable::Method method_;
+  double tolerance_;
+  int spread_width_;
+  int block_size_{64};
+  std::vector<Degree> degrees_;
+};
+
+inline PeriodicTermNUFFT::PeriodicTermNUFFT(const PeriodicTermTable &table,
+                                            double tolerance)
+    : method_(table.method), tolerance_(std::max(tolerance, kMinTolerance)) {
+  // Gridding error of sum(|w|) within exp(-1.7 spread_width) on the VSOP87
+  // series, for the oversampling 2 (Greengard & Lee estimate
+  // exp(-2 pi spread_width / 3))
+  spread_width_ = std::clamp(
+      static_cast<int>(std::ceil(-std::log(tolerance_) / 1.7)), 2, 16);
+  for (int degree = 0; degree < table.size; degree++) {
+    const PeriodicTermTableDegree &table_degree{table.degrees[degree]};
+    Degree d{{}, {}, {}, 0.0, 0.0, 0.0};
+    for (int i = 0; i < table_degree.size; i++) {
+      const PeriodicTerm &pt{table_degree.terms[i]};
+      d.a.push_back(pt.a);
+      d.b.push_back(pt.b);
+      d.c.push_back(pt.c);
+      d.magnitude += std::fabs(pt.a);
+      d.phase_magnitude += std::fabs(pt.a * pt.b);
+      d.rate_magnitude += std::fabs(pt.a * pt.c);
+    }
+    degrees_.push_back(std::move(d));
+  }
+
+  // Each term updates 4 spread_width_ points (with the mirrored ones) of the
+  // grid of 2 block_size_ points of each pair of degrees
+  std::size_t spread_points{0};
+  for (const Degree &d : degrees_) spread_points += 4 * spread_width_ * d.a.size();
+  std::size_t fft_count{(degrees_.size() + 1) / 2};
+  while (block_size_ < kMaxBlockSize &&
+         fft_count * kOversampling * block_size_ < spread_points) {
+    block_size_ *= 2;
+  }
+}
+
+inline double PeriodicTermNUFFT::GetErrorBound(double t_max) const noexcept {
+  double bound{0.0};
+  double t_power{1.0};
+  constexpr double kUlp1{0x1.0p-52};
+  // FFT rounding errors, amplified by up to exp(n^2 tau) = exp(pi W / 12) at
+  // the ends of a block when the Gaussian is divided out
+  double rounding{4.0 * std::exp(M_PI * spread_width_ / 12.0) * kUlp1 *
+                  std::log2(kOversampling * block_size_)};
+  for (const Degree &d : degrees_) {
+    bound += ((tolerance_ + rounding) * d.magnitude +
+              (d.phase_magnitude + 4.0 * d.rate_magnitude * std::fabs(t_max)) *
+                  kUlp1) *
+             t_power;
+    t_power *= std::fabs(t_max);
+  }
+  return bound;
+}
+
+inline void PeriodicTermNUFFT::Compute(double t0, double dt,
+                                       std::span<double> values) const {
+  int count{static_cast<int>(values.size())};
+  if (count == 0) return;
+  int block_size{64};
+  while (block_size < count && block_size < block_size_) block_size *= 2;
+  FFT fft{kOversampling * block_size};
+  std::vector<std::complex<double>> grid(fft.GetSize());
+  std::vector<double> sums(degrees_.size() * block_size);
+
+  for (int begin = 0; begin < count; begin += block_size) {
+    // Samples n = -block_size / 2, ... around tc, at the middle of those of
+    // the block
+    int end{std::min(begin + block_size, count)};
+    int center{(begin + end) / 2};
+    ComputeBlock(t0 + center * dt, dt, fft, &grid, &sums);
+    for (int i = begin; i < end; i++) {
+      double t{t0 + i * dt};
+      int k{i - center + block_size / 2};
+      double value{0.0};
+      for (int degree = static_cast<int>(degrees_.size()) - 1; degree >= 0;
+           degree--) {
+        value = value * t + sums[degree * block_size + k];
+      }
+      values[i] = value;
+    }
+  }
+}
+
+inline void PeriodicTermNUFFT::ComputeBlock(
+    double tc, double dt, const FFT &fft,
+    std::vector<std::complex<double>> *p_grid,
+    std::vector<double> *p_sums) const {
+  int grid_size{fft.GetSize()};
+  int block_size{grid_size / kOversampling};
+  double grid_step{2.0 * M_PI / grid_size};
+  // Gaussian exp(-x^2 / (4 tau)) of Greengard & Lee, for the oversampling 2
+  double tau{M_PI * spread_width_ /
+             (static_cast<double>(block_size) * block_size * kOversampling *
+              (kOversampling - 0.5))};
+  // exp(-(k * grid_step)^2 / (4 tau)) of the offsets k
+  std::vector<double> offset_weights(spread_width_ + 1);
+  for (int k = 0; k <= spread_width_; k++) {
+    offset_weights[k] =
+        std::exp(-(k * grid_step) * (k * grid_step) / (4.0 * tau));
+  }
+  std::vector<std::complex<double>> &grid{*p_grid};
+
+  // Fast Gaussian gridding of the value w at x in [0, 2 pi), and of w_mirror
+  // at -x on the mirrored grid points, so that the two approximations are
+  // conjugate when w_mirror = conj(w):
+  // exp(-(delta + k step)^2 / (4 tau)) = exp(-delta^2 / (4 tau))
+  // * exp(-step delta / (2 tau))^k * offset_weights[k]
+  auto spread{[&](double x, std::complex<double> w,
+                  std::complex<double> w_mirror) {
+    int m0{static_cast<int>(x / grid_step)};
+    double delta{m0 * grid_step - x};
+    double e1{std::exp(-delta * delta / (4.0 * tau))};
+    double e2{std::exp(-grid_step * delta / (2.0 * tau))};
+    double e2_inverse{1.0 / e2};
+    double up{e1};
+    double down{e1 * e2_inverse};
+    auto add{[&](int m, double weight) {
+      std::complex<double> &p{grid[m & (grid_size - 1)]};
+      std::complex<double> &p_mirror{grid[-m & (grid_size - 1)]};
+      p = {p.real() + w.real() * weight, p.imag() + w.imag() * weight};
+      p_mirror = {p_mirror.real() + w_mirror.real() * weight,
+                  p_mirror.imag() + w_mirror.imag() * weight};
+    }};
+    for (int k = 0; k < spread_width_; k++) {
+      // Offsets k and -(k + 1)
+      add(m0 + k, up * offset_weights[k]);
+      add(m0 - k - 1, down * offset_weights[k + 1]);
+      up *= e2;
+      down *= e2_inverse;
+    }
+  }};
+
+  // Two degrees per FFT: Re(w exp(i n x)) is the real sum of w / 2 at x and
+  // conj(w) / 2 at -x, so that the first degree of the pair comes out in the
+  // real part and the second, spread times i, in the imaginary part
+  // - The second degree is scaled by a power of two to the magnitude of the
+  //   first, so that the rounding errors of each stay relative to its own
+  int degree_count{static_cast<int>(degrees_.size())};
+  for (int first = 0; first < degree_count; first += 2) {
+    double second_scale{1.0};
+    if (first + 1 < degree_count && degrees_[first + 1].magnitude > 0.0 &&
+        degrees_[first].magnitude > 0.0) {
+      second_scale = std::exp2(std::round(std::log2(
+          degrees_[first].magnitude / degrees_[first + 1].magnitude)));
+    }
+    std::fill(grid.begin(), grid.end(), std::complex<double>{});
+    for (int degree = first; degree < std::min(first + 2, degree_count);
+         degree++) {
+      const Degree &d{degrees_[degree]};
+      for (std::size_t j = 0; j < d.a.size(); j++) {
+        double x{std::fmod(d.c[j] * dt, 2.0 * M_PI)};
+        if (x < 0.0) x += 2.0 * M_PI;
+        double phase{d.b[j] + d.c[j] * tc};
+        // a cos(phase + n x) = Re(w exp(i n x)); a sin(...) with w / i
+        double sin_phase, cos_phase;
+        SIMD::SinCos(phase, &sin_phase, &cos_phase);
+        double w_re{0.5 * d.a[j] * cos_phase};
+        double w_im{0.5 * d.a[j] * sin_phase};
+        std::complex<double> w{method_ == PeriodicTermTable::Method::kSin
+                                   ? std::complex<double>{w_im, -w_re}
+                                   : std::complex<double>{w_re, w_im}};
+        if (degree > first) {
+          w = {-second_scale * w.imag(), second_scale * w.real()};
+        }
+        spread(x, w, degree > first ? -std::conj(w) : std::conj(w));
+      }
+    }
+
+    fft.Transform(grid, true);
+
+    // Divides out the Fourier coefficients sqrt(tau / pi) exp(-n^2 tau) of the
+    // Gaussian, and the grid size of the quadrature
+    double scale{std::sqrt(M_PI / tau) / grid_size};
+    double *sums{p_sums->data() + first * block_size};
+    for (int i = 0; i < block_size; i++) {
+      int n{i - block_size / 2};
+      const std::complex<double> &h{grid[n & (grid_size - 1)]};
+      double factor{scale * std::exp(n * static_cast<double>(n) * tau)};
+      sums[i] = factor * h.real();
+      if (first + 1 < degree_count) {
+        sums[block_size + i] = factor / second_scale * h.imag();
+      }
+    }
+  }
+}
+
+}  // namespace PA
+
+#endif  // PERIODIC_TERM_NUFFT_H_
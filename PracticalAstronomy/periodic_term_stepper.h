@@ -0,0 +1,150 @@
+#ifndef PERIODIC_TERM_STEPPER_H_
+#define PERIODIC_TERM_STEPPER_H_
+
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "simd.h"
+#include "utils.h"
+
+namespace PA {
+
+// Evaluation of a PeriodicTermTable on the uniform grid t_n = t0 + n * dt
+// - Each term keeps (sin, cos) of its argument b + c * t_n and advances it by
+//   the rotation (sin, cos)(c * dt) with the angle-addition formulas, so that
+//   a step takes multiply-adds only
+// - The rounding errors of the rotations accumulate linearly with the steps:
+//   every reseed_interval steps the arguments are evaluated afresh at t_n,
+//   which bounds the drift
+// - Accuracy: |error| <= (4 * reseed_interval + 2) ulp(1) * sum(|a * t^degree|)
+//   w.r.t. PeriodicTermComputeScalar()
+class PeriodicTermStepper {
+ public:
+  static constexpr int kDefaultReseedInterval{1024};
+
+  PeriodicTermStepper(const PeriodicTermTable &table, double t0, double dt,
+                      int reseed_interval = kDefaultReseedInterval);
+
+  double GetT() const noexcept { return t0_ + step_ * dt_; }
+  inline double Compute() const noexcept;
+  inline void Step() noexcept;
+  // values[k] = value at the k-th next grid point, starting with the current
+  // one; leaves the stepper after the last of them
+  inline void Compute(std::span<double> values) noexcept;
+
+ private:
+  // Terms of a degree in [begin, end) of the state arrays
+  struct Degree {
+    int begin;
+    int end;
+  };
+
+  inline void Reseed() noexcept;
+
+  PeriodicTermTable::Method method_;
+  double t0_;
+  double dt_;
+  int reseed_interval_;
+  int64_t step_{0};
+  std::vector<Degree> degrees_;
+  // Per term, each degree zero-padded to whole vectors
+  std::vector<double> a_, b_, c_;
+  std::vector<double> sin_, cos_;
+  std::vector<double> sin_step_, cos_step_;
+};
+
+inline PeriodicTermStepper::PeriodicTermStepper(const PeriodicTermTable &table,
+                                                double t0, double dt,
+                                                int reseed_interval)
+    : method_(table.method),
+      t0_(t0),
+      dt_(dt),
+      reseed_interval_(reseed_interval > 0 ? reseed_interval : 1) {
+  using SIMD::kWidth;
+  for (int degree = 0; degree < table.size; degree++) {
+    const PeriodicTermTableDegree &table_degree{table.degrees[degree]};
+    int begin{static_cast<int>(a_.size())};
+    int end{begin + (table_degree.size + kWidth - 1) / kWidth * kWidth};
+    for (int i = 0; i < end - begin; i++) {
+      bool is_term{i < table_degree.size};
+      a_.push_back(is_term ? table_degree.terms[i].a : 0.0);
+      b_.push_back(is_term ? table_degree.terms[i].b : 0.0);
+      c_.push_back(is_term ? table_degree.terms[i].c : 0.0);
+    }
+    degrees_.push_back(Degree{begin, end});
+  }
+  sin_.resize(a_.size());
+  cos_.resize(a_.size());
+  sin_step_.resize(a_.size());
+  cos_step_.resize(a_.size());
+  for (std::size_t i = 0; i < a_.size(); i += kWidth) {
+    SIMD::VecD sin_step, cos_step;
+    SIMD::SinCos(SIMD::Load(&c_[i]) * dt_, &sin_step, &cos_step);
+    SIMD::Store(&sin_step_[i], sin_step);
+    SIMD::Store(&cos_step_[i], cos_step);
+  }
+  Reseed();
+}
+
+inline void PeriodicTermStepper::Reseed() noexcept {
+  using SIMD::kWidth;
+  double t{GetT()};
+  for (std::size_t i = 0; i < a_.size(); i += kWidth) {
+    SIMD::VecD s, c;
+    SIMD::SinCos(SIMD::Load(&b_[i]) + SIMD::Load(&c_[i]) * t, &s, &c);
+    SIMD::Store(&sin_[i], s);
+    SIMD::Store(&cos_[i], c);
+  }
+}
+
+inline double PeriodicTermStepper::Compute() const noexcept {
+  using SIMD::kWidth;
+  using SIMD::VecD;
+  const std::vector<double> &trig{
+      method_ == PeriodicTermTable::Method::kSin ? sin_ : cos_};
+  double t{GetT()};
+  double value{0.0};
+  for (int degree = static_cast<int>(degrees_.size()) - 1; degree >= 0;
+       degree--) {
+    VecD sum{};
+    for (int i = degrees_[degree].begin; i < degrees_[degree].end;
+         i += kWidth) {
+      sum += SIMD::Load(&a_[i]) * SIMD::Load(&trig[i]);
+    }
+    value = value * t + SIMD::ReduceAdd(sum);
+  }
+  return value;
+}
+
+inline void PeriodicTermStepper::Step() noexcept {
+  using SIMD::kWidth;
+  using SIMD::VecD;
+  step_++;
+  if (step_ % reseed_interval_ == 0) {
+    Reseed();
+    return;
+  }
+  // sin(x + d) = sin(x) cos(d) + cos(x) sin(d)
+  // cos(x + d) = cos(x) cos(d) - sin(x) sin(d)
+  for (std::size_t i = 0; i < a_.size(); i += kWidth) {
+    VecD s{SIMD::Load(&sin_[i])};
+    VecD c{SIMD::Load(&cos_[i])};
+    VecD sd{SIMD::Load(&sin_step_[i])};
+    VecD cd{SIMD::Load(&cos_step_[i])};
+    SIMD::Store(&sin_[i], s * cd + c * sd);
+    SIMD::Store(&cos_[i], c * cd - s * sd);
+  }
+}
+
+inline void PeriodicTermStepper::Compute(std::span<double> values) noexcept {
+  for (double &value : values) {
+    value = Compute();
+    Step();
+  }
+}
+
+}  // namespace PA
+
+#endif  // PERIODIC_TERM_STEPPER_H_
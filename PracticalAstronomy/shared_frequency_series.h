@@ -0,0 +1,139 @@
+#ifndef SHARED_FREQUENCY_SERIES_H_
+#define SHARED_FREQUENCY_SERIES_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "simd.h"
+#include "simd_dispatch.h"
+#include "utils.h"
+
+namespace PA {
+
+// A SharedFrequencyTable (see utils.h) in structure-of-arrays form
+// - The sin/cos of c t of each distinct frequency are computed once at t,
+//   vectorized, and shared by the terms of all the tables: the VSOP87D tables
+//   of a planet have about 3.8 times fewer frequencies than terms
+// - Blocks: one per (table, degree), each with its frequency indices, p and q
+//   arrays zero-padded to whole vectors of any ISA
+// - Evaluated with the kernels of the host ISA (see simd_dispatch.h)
+class SharedFrequencySeries {
+ public:
+  static constexpr std::size_t kAlignment{64};
+
+  SharedFrequencySeries() noexcept {}
+  explicit inline SharedFrequencySeries(const SharedFrequencyTable &table);
+
+  int GetTableCount() const noexcept { return table_count_; }
+
+  // values[k] = sum(t^degree * sum(p cos(c t) + q sin(c t))) of tables[k]
+  // - Accuracy: Within twice PeriodicTermComputeSIMDErrorBound() (see utils.h)
+  //   of the PeriodicTermTable the table was generated from, as
+  //   |p| + |q| <= sqrt(2) |a|
+  inline void Compute(double t, double *values) const noexcept;
+
+ private:
+  struct Block {
+    std::size_t offset;  // Of the frequency indices, and of p; q follows p
+    int size;            // Padded to whole vectors of any ISA
+    int table;
+    int degree;
+  };
+
+  struct AlignedDelete {
+    void operator()(double *p) const noexcept {
+      ::operator delete[](p, std::align_val_t{kAlignment});
+    }
+  };
+
+  static constexpr int kMaxDegreeCount{8};
+
+  int table_count_{0};
+  int degree_count_{0};
+  int frequency_count_{0};  // Padded to whole vectors of any ISA
+  // The frequencies, then p and q of each block
+  std::unique_ptr<double[], AlignedDelete> storage_;
+  std::vector<int> frequency_indices_;
+  std::vector<Block> blocks_;
+};
+
+inline SharedFrequencySeries::SharedFrequencySeries(
+    const SharedFrequencyTable &table)
+    : table_count_{table.table_count} {
+  using SIMD::kMaxWidth;
+  auto round_up{
+      [](int n) { return (n + kMaxWidth - 1) / kMaxWidth * kMaxWidth; }};
+
+  frequency_count_ = round_up(table.frequency_count);
+  std::size_t offset{0};
+  for (int k = 0; k < table.table_count; k++) {
+    const FrequencyTermTable &term_table{table.tables[k]};
+    for (int degree = 0; degree < term_table.size; degree++) {
+      int size{round_up(term_table.degrees[degree].size)};
+      if (size == 0) continue;
+      blocks_.push_back(Block{offset, size, k, degree});
+      offset += size;
+    }
+    degree_count_ = std::max(degree_count_, term_table.size);
+    assert(degree_count_ <= kMaxDegreeCount);
+  }
+
+  storage_.reset(static_cast<double *>(
+      ::operator new[]((frequency_count_ + 2 * offset + 1) * sizeof(double),
+                       std::align_val_t{kAlignment})));
+  frequency_indices_.resize(offset);
+  double *frequencies{storage_.get()};
+  for (int i = 0; i < frequency_count_; i++) {
+    frequencies[i] = i < table.frequency_count ? table.frequencies[i] : 0.0;
+  }
+  for (const Block &block : blocks_) {
+    const FrequencyTermTableDegree &term_table_degree{
+        table.tables[block.table].degrees[block.degree]};
+    int *indices{frequency_indices_.data() + block.offset};
+    double *p{frequencies + frequency_count_ + 2 * block.offset};
+    double *q{p + block.size};
+    for (int i = 0; i < block.size; i++) {
+      bool is_term{i < term_table_degree.size};
+      indices[i] = is_term ? term_table_degree.terms[i].frequency : 0;
+      p[i] = is_term ? term_table_degree.terms[i].p : 0.0;
+      q[i] = is_term ? term_table_degree.terms[i].q : 0.0;
+    }
+  }
+}
+
+inline void SharedFrequencySeries::Compute(double t,
+                                           double *values) const noexcept {
+  const SIMD::Kernels &kernels{SIMD::GetKernels()};
+  // sin/cos of the frequencies, reused across the calls of each thread
+  thread_local std::vector<double> sin_cos;
+  if (sin_cos.size() < 2 * static_cast<std::size_t>(frequency_count_)) {
+    sin_cos.resize(2 * frequency_count_);
+  }
+  double *sin_x{sin_cos.data()};
+  double *cos_x{sin_x + frequency_count_};
+  const double *frequencies{storage_.get()};
+  kernels.frequency_sincos(frequencies, frequency_count_, t, sin_x, cos_x);
+
+  double t_powers[kMaxDegreeCount];
+  t_powers[0] = 1.0;
+  for (int degree = 1; degree < degree_count_; degree++) {
+    t_powers[degree] = t_powers[degree - 1] * t;
+  }
+  for (int k = 0; k < table_count_; k++) values[k] = 0.0;
+
+  for (const Block &block : blocks_) {
+    const double *p{frequencies + frequency_count_ + 2 * block.offset};
+    double sum{kernels.frequency_sums(frequency_indices_.data() + block.offset,
+                                      p, p + block.size, block.size, sin_x,
+                                      cos_x)};
+    values[block.table] += t_powers[block.degree] * sum;
+  }
+}
+
+}  // namespace PA
+
+#endif  // SHARED_FREQUENCY_SERIES_H_
@@ -0,0 +1,372 @@
+#ifndef SIMD_H_
+#define SIMD_H_
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Portable SIMD layer built on the G++ vector extensions
+// - The lane count follows the target ISA of the translation unit:
+//   2 lanes for SSE2 (x86-64 baseline), 4 lanes for AVX/AVX2 and 8 lanes for
+//   AVX-512F
+// - Build with e.g. -march=native to get the widest vectors of the host
+// - Everything lives in an inline namespace named after that ISA, so that
+//   translation units built for different ISAs (see simd_dispatch.h) can be
+//   linked together without clashing inline definitions
+
+#if defined(__AVX512F__)
+#define PA_SIMD_ISA AVX512
+#elif defined(__AVX2__)
+#define PA_SIMD_ISA AVX2
+#elif defined(__AVX__)
+#define PA_SIMD_ISA AVX
+#else
+#define PA_SIMD_ISA SSE2
+#endif
+
+namespace PA {
+namespace SIMD {
+
+// Lanes of the widest vectors of any ISA: Padding that suits all kernels
+constexpr int kMaxWidth{8};
+// Single precision: Lanes of the widest and of the narrowest vectors of any
+// ISA
+constexpr int kMaxFloatWidth{2 * kMaxWidth};
+constexpr int kMinFloatWidth{4};
+
+inline namespace PA_SIMD_ISA {
+
+#if defined(__AVX512F__)
+constexpr int kWidth{8};
+#elif defined(__AVX__)
+constexpr int kWidth{4};
+#else
+constexpr int kWidth{2};
+#endif
+
+typedef double VecD __attribute__((vector_size(sizeof(double) * kWidth)));
+typedef int64_t VecL __attribute__((vector_size(sizeof(int64_t) * kWidth)));
+
+// Single precision: Twice the lanes in the same registers
+constexpr int kFloatWidth{2 * kWidth};
+typedef float VecF __attribute__((vector_size(sizeof(float) * kFloatWidth)));
+typedef int32_t VecI __attribute__((vector_size(sizeof(int32_t) * kFloatWidth)));
+
+inline VecD Broadcast(double x) noexcept { return VecD{} + x; }
+
+inline VecD Load(const double *p) noexcept {
+  VecD v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline void Store(double *p, VecD v) noexcept { std::memcpy(p, &v, sizeof(v)); }
+
+inline VecF Load(const float *p) noexcept {
+  VecF v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+// Lanes of lo, then those of hi, rounded to single precision
+inline VecF ConvertToFloat(VecD lo, VecD hi) noexcept {
+  VecF v;
+  for (int i = 0; i < kWidth; i++) {
+    v[i] = static_cast<float>(lo[i]);
+    v[kWidth + i] = static_cast<float>(hi[i]);
+  }
+  return v;
+}
+
+inline double ReduceAdd(VecD v) noexcept {
+  double sum{0.0};
+  for (int i = 0; i < kWidth; i++) sum += v[i];
+  return sum;
+}
+
+// Summed in double precision
+inline double ReduceAdd(VecF v) noexcept {
+  double sum{0.0};
+  for (int i = 0; i < kFloatWidth; i++) sum += v[i];
+  return sum;
+}
+
+inline VecD Select(VecL mask, VecD if_true, VecD if_false) noexcept {
+  return (VecD)((mask & (VecL)if_true) | (~mask & (VecL)if_false));
+}
+
+inline VecF Select(VecI mask, VecF if_true, VecF if_false) noexcept {
+  return (VecF)((mask & (VecI)if_true) | (~mask & (VecI)if_false));
+}
+
+/* Sine and Cosine
+ * - Argument reduction: Cody-Waite with pi/2 split into two 28-bit parts and
+ *   a double, so that j * part is exact for the quadrants |j| < 2^25; the
+ *   residue of the split (4e-35) adds < 2^-90 to r
+ * - Kernels: fdlibm __kernel_sin/__kernel_cos minimax polynomials on
+ *   [-pi/4, pi/4]
+ * - Accuracy: |error| <= 2 ulp(1) = 2^-51 against the exact sin/cos of the
+ *   (double) argument for |x| <= kSinCosMaxArgument; lanes beyond that fall
+ *   back to libm
+ * - Scalar forms (double): Same reduction and kernels, so that a scalar engine
+ *   gets the same results as the lanes of the vector kernels; libm when
+ *   evaluated as a constant expression
+ * - kSinCosMaxArgument (2^25 quadrants) covers the arguments of the theories
+ *   far beyond their validity: VSOP87 (|c| <= 4.2e5 per millennium) over
+ *   +-100 millennia, and the multiples of the Delaunay arguments of ELP82JM
+ *   and of the nutation models (<= 6e4 per century) over +-80 millennia
+ */
+
+constexpr double kSinCosMaxArgument{5.0e7};
+
+namespace Internal {
+
+constexpr double kTwoOverPi{6.36619772367581382433e-01};
+constexpr double kPiOverTwo1{1.57079632580280303955e+00};
+constexpr double kPiOverTwo2{9.92093580898245619437e-10};
+constexpr double kPiOverTwo3{-1.21770517779739658089e-18};
+// Adding 1.5 * 2^52 rounds to an integer, which is then found in the low bits
+// of the mantissa
+constexpr double kRoundMagic{6755399441055744.0};
+constexpr int64_t kSignBit{INT64_MIN};
+
+constexpr double kS1{-1.66666666666666324348e-01};
+constexpr double kS2{8.33333333332248946124e-03};
+constexpr double kS3{-1.98412698298579493134e-04};
+constexpr double kS4{2.75573137070700676789e-06};
+constexpr double kS5{-2.50507602534068634195e-08};
+constexpr double kS6{1.58969099521155010221e-10};
+
+constexpr double kC1{4.16666666666666019037e-02};
+constexpr double kC2{-1.38888888888741095749e-03};
+constexpr double kC3{2.48015872894767294178e-05};
+constexpr double kC4{-2.75573143513906633035e-07};
+constexpr double kC5{2.08757232129817482790e-09};
+constexpr double kC6{-1.13596475577881948265e-11};
+
+inline void Reduce(VecD x, VecD *p_r, VecL *p_quadrant) noexcept {
+  VecD k{x * kTwoOverPi + kRoundMagic};
+  VecD j{k - kRoundMagic};
+  *p_r = ((x - j * kPiOverTwo1) - j * kPiOverTwo2) - j * kPiOverTwo3;
+  *p_quadrant = (VecL)k & 3;
+}
+
+// For both VecD and double
+template <class V>
+inline V SinKernel(V r, V z) noexcept {
+  V p{kS2 + z * (kS3 + z * (kS4 + z * (kS5 + z * kS6)))};
+  return r + z * r * (kS1 + z * p);
+}
+
+template <class V>
+inline V CosKernel(V z) noexcept {
+  V p{z * (kC1 + z * (kC2 + z * (kC3 + z * (kC4 + z * (kC5 + z * kC6)))))};
+  V hz{0.5 * z};
+  V w{1.0 - hz};
+  return w + (((1.0 - w) - hz) + z * p);
+}
+
+// r in [-pi/4, pi/4] and the quadrant (0 to 3) of a scalar
+inline double Reduce(double x, int *p_quadrant) noexcept {
+  double k{x * kTwoOverPi + kRoundMagic};
+  double j{k - kRoundMagic};
+  int64_t bits;
+  std::memcpy(&bits, &k, sizeof(bits));
+  *p_quadrant = static_cast<int>(bits & 3);
+  return ((x - j * kPiOverTwo1) - j * kPiOverTwo2) - j * kPiOverTwo3;
+}
+
+inline bool OutOfRange(VecD x) noexcept {
+  VecL mask{(x > kSinCosMaxArgument) | (x < -kSinCosMaxArgument) | (x != x)};
+  for (int i = 0; i < kWidth; i++) {
+    if (mask[i]) return true;
+  }
+  return false;
+}
+
+}  // namespace Internal
+
+inline void SinCos(VecD x, VecD *p_sin, VecD *p_cos) noexcept {
+  using namespace Internal;
+  if (OutOfRange(x)) {
+    for (int i = 0; i < kWidth; i++) {
+      (*p_sin)[i] = std::sin(x[i]);
+      (*p_cos)[i] = std::cos(x[i]);
+    }
+    return;
+  }
+  VecD r;
+  VecL q;
+  Reduce(x, &r, &q);
+  VecD z{r * r};
+  VecD s{SinKernel(r, z)};
+  VecD c{CosKernel(z)};
+  VecL swap{(q & 1) != 0};
+  *p_sin = (VecD)((VecL)Select(swap, c, s) ^ (((q & 2) != 0) & kSignBit));
+  *p_cos = (VecD)((VecL)Select(swap, s, c) ^ ((((q + 1) & 2) != 0) & kSignBit));
+}
+
+inline VecD Sin(VecD x) noexcept {
+  using namespace Internal;
+  if (OutOfRange(x)) {
+    for (int i = 0; i < kWidth; i++) x[i] = std::sin(x[i]);
+    return x;
+  }
+  VecD r;
+  VecL q;
+  Reduce(x, &r, &q);
+  VecD z{r * r};
+  VecD v{Select((q & 1) != 0, CosKernel(z), SinKernel(r, z))};
+  return (VecD)((VecL)v ^ (((q & 2) != 0) & kSignBit));
+}
+
+inline VecD Cos(VecD x) noexcept {
+  using namespace Internal;
+  if (OutOfRange(x)) {
+    for (int i = 0; i < kWidth; i++) x[i] = std::cos(x[i]);
+    return x;
+  }
+  VecD r;
+  VecL q;
+  Reduce(x, &r, &q);
+  VecD z{r * r};
+  VecD v{Select((q & 1) != 0, SinKernel(r, z), CosKernel(z))};
+  return (VecD)((VecL)v ^ ((((q + 1) & 2) != 0) & kSignBit));
+}
+
+constexpr void SinCos(double x, double *p_sin, double *p_cos) noexcept {
+  if (std::is_constant_evaluated() || !(std::fabs(x) <= kSinCosMaxArgument)) {
+    *p_sin = std::sin(x);
+    *p_cos = std::cos(x);
+    return;
+  }
+  int q;
+  double r{Internal::Reduce(x, &q)};
+  double z{r * r};
+  double s{Internal::SinKernel(r, z)};
+  double c{Internal::CosKernel(z)};
+  switch (q) {
+    case 0:
+      *p_sin = s;
+      *p_cos = c;
+      break;
+    case 1:
+      *p_sin = c;
+      *p_cos = -s;
+      break;
+    case 2:
+      *p_sin = -s;
+      *p_cos = -c;
+      break;
+    default:
+      *p_sin = -c;
+      *p_cos = s;
+      break;
+  }
+}
+
+constexpr double Sin(double x) noexcept {
+  if (std::is_constant_evaluated() || !(std::fabs(x) <= kSinCosMaxArgument)) {
+    return std::sin(x);
+  }
+  int q;
+  double r{Internal::Reduce(x, &q)};
+  double z{r * r};
+  double v{(q & 1) ? Internal::CosKernel(z) : Internal::SinKernel(r, z)};
+  return (q & 2) ? -v : v;
+}
+
+constexpr double Cos(double x) noexcept {
+  if (std::is_constant_evaluated() || !(std::fabs(x) <= kSinCosMaxArgument)) {
+    return std::cos(x);
+  }
+  int q;
+  double r{Internal::Reduce(x, &q)};
+  double z{r * r};
+  double v{(q & 1) ? Internal::SinKernel(r, z) : Internal::CosKernel(z)};
+  return ((q + 1) & 2) ? -v : v;
+}
+
+/* Sine and Cosine in Single Precision
+ * - Domain: |x| <= pi, i.e. arguments already reduced (see ReduceTwoPi())
+ * - Reduction to [-pi/4, pi/4]: pi/2 split into three float parts, exact for
+ *   the quadrants |j| <= 2
+ * - Kernels: Cephes sinf/cosf polynomials
+ * - Accuracy: |error| <= kFloatSinCosError against the exact sin/cos of the
+ *   (float) argument
+ */
+
+constexpr double kFloatSinCosError{2.0 * 0x1.0p-24};
+
+namespace Internal {
+
+constexpr float kTwoOverPiF{0.636619772367581f};
+constexpr float kPiOverTwo1F{1.5703125f};
+constexpr float kPiOverTwo2F{4.837512969970703125e-4f};
+constexpr float kPiOverTwo3F{7.54978995489188216e-8f};
+
+constexpr float kS1F{-1.6666654611e-1f};
+constexpr float kS2F{8.3321608736e-3f};
+constexpr float kS3F{-1.9515295891e-4f};
+
+constexpr float kC1F{4.166664568298827e-2f};
+constexpr float kC2F{-1.388731625493765e-3f};
+constexpr float kC3F{2.443315711809948e-5f};
+
+// Adding 1.5 * 2^23 rounds to an integer
+constexpr float kRoundMagicF{12582912.0f};
+constexpr int32_t kSignBitF{INT32_MIN};
+
+inline void ReduceF(VecF x, VecF *p_r, VecI *p_quadrant) noexcept {
+  VecF j{(x * kTwoOverPiF + kRoundMagicF) - kRoundMagicF};
+  *p_r = ((x - j * kPiOverTwo1F) - j * kPiOverTwo2F) - j * kPiOverTwo3F;
+  *p_quadrant = __builtin_convertvector(j, VecI) & 3;
+}
+
+inline VecF SinKernelF(VecF r, VecF z) noexcept {
+  return r + r * z * (kS1F + z * (kS2F + z * kS3F));
+}
+
+inline VecF CosKernelF(VecF z) noexcept {
+  return 1.0f - 0.5f * z + z * z * (kC1F + z * (kC2F + z * kC3F));
+}
+
+}  // namespace Internal
+
+inline VecF Sin(VecF x) noexcept {
+  using namespace Internal;
+  VecF r;
+  VecI q;
+  ReduceF(x, &r, &q);
+  VecF z{r * r};
+  VecF v{Select((q & 1) != 0, CosKernelF(z), SinKernelF(r, z))};
+  return (VecF)((VecI)v ^ (((q & 2) != 0) & kSignBitF));
+}
+
+inline VecF Cos(VecF x) noexcept {
+  using namespace Internal;
+  VecF r;
+  VecI q;
+  ReduceF(x, &r, &q);
+  VecF z{r * r};
+  VecF v{Select((q & 1) != 0, SinKernelF(r, z), CosKernelF(z))};
+  return (VecF)((VecI)v ^ ((((q + 1) & 2) != 0) & kSignBitF));
+}
+
+// x - 2 pi round(x / (2 pi)), in [-pi, pi]
+// - Error: <= 2 ulp(x), from the rounding of the multiple of 2 pi
+inline VecD ReduceTwoPi(VecD x) noexcept {
+  using namespace Internal;
+  constexpr double kOneOverTwoPi{1.59154943091895335769e-01};
+  constexpr double kTwoPi1{6.28318530717958623200e+00};
+  constexpr double kTwoPi2{2.44929359829470635445e-16};
+  VecD k{(x * kOneOverTwoPi + kRoundMagic) - kRoundMagic};
+  return (x - k * kTwoPi1) - k * kTwoPi2;
+}
+
+}  // namespace PA_SIMD_ISA
+}  // namespace SIMD
+}  // namespace PA
+
+#endif  // SIMD_H_
@@ -0,0 +1,104 @@
+#include "simd_dispatch.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+namespace PA {
+namespace SIMD {
+
+// The tables of simd_kernels.cpp, one per ISA (see Makefile)
+namespace SSE2 {
+extern const Kernels kKernels;
+}
+namespace AVX2 {
+extern const Kernels kKernels;
+}
+namespace AVX512 {
+extern const Kernels kKernels;
+}
+
+namespace {
+
+constexpr const Kernels *kISAKernels[]{
+    [static_cast<int>(ISA::kSSE2)] = &SSE2::kKernels,
+    [static_cast<int>(ISA::kAVX2)] = &AVX2::kKernels,
+    [static_cast<int>(ISA::kAVX512)] = &AVX512::kKernels,
+};
+
+constexpr const char *kISANames[]{
+    [static_cast<int>(ISA::kSSE2)] = "sse2",
+    [static_cast<int>(ISA::kAVX2)] = "avx2",
+    [static_cast<int>(ISA::kAVX512)] = "avx512",
+};
+
+std::atomic<const Kernels *> kernels{nullptr};
+
+ISA GetWidestISA() noexcept {
+  for (int i = static_cast<int>(ISA::kMax) - 1; i > 0; i--) {
+    if (IsISASupported(static_cast<ISA>(i))) return static_cast<ISA>(i);
+  }
+  return ISA::kSSE2;
+}
+
+// PA_SIMD_ISA if set to a supported ISA, else the widest one
+ISA GetDefaultISA() noexcept {
+  const char *name{std::getenv("PA_SIMD_ISA")};
+  if (name) {
+    for (int i = 0; i < static_cast<int>(ISA::kMax); i++) {
+      if (std::strcmp(name, kISANames[i]) == 0 &&
+          IsISASupported(static_cast<ISA>(i))) {
+        return static_cast<ISA>(i);
+      }
+    }
+  }
+  return GetWidestISA();
+}
+
+}  // namespace
+
+const Kernels &GetKernels() noexcept {
+  const Kernels *p{kernels.load(std::memory_order_acquire)};
+  if (!p) {
+    // Racing first calls all store the same table
+    p = kISAKernels[static_cast<int>(GetDefaultISA())];
+    kernels.store(p, std::memory_order_release);
+  }
+  return *p;
+}
+
+const char *GetISAName(ISA isa) noexcept {
+  return isa < ISA::kMax ? kISANames[static_cast<int>(isa)] : "auto";
+}
+
+bool IsISASupported(ISA isa) noexcept {
+  switch (isa) {
+    case ISA::kSSE2:
+      return true;
+    case ISA::kAVX2:
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case ISA::kAVX512:
+      return IsISASupported(ISA::kAVX2) &&
+             __builtin_cpu_supports("avx512f") &&
+             __builtin_cpu_supports("avx512bw") &&
+             __builtin_cpu_supports("avx512cd") &&
+             __builtin_cpu_supports("avx512dq") &&
+             __builtin_cpu_supports("avx512vl");
+    default:
+      return false;
+  }
+}
+
+bool SetISA(ISA isa) noexcept {
+  if (isa == ISA::kMax) {
+    kernels.store(kISAKernels[static_cast<int>(GetDefaultISA())],
+                  std::memory_order_release);
+    return true;
+  }
+  if (!IsISASupported(isa)) return false;
+  kernels.store(kISAKernels[static_cast<int>(isa)], std::memory_order_release);
+  return true;
+}
+
+}  // namespace SIMD
+}  // namespace PA
@@ -0,0 +1,95 @@
+#ifndef SIMD_DISPATCH_H_
+#define SIMD_DISPATCH_H_
+
+struct PeriodicTermTable;
+
+namespace PA {
+namespace SIMD {
+
+// Run-time selection of the vector kernels
+// - simd_kernels.cpp is built once per ISA below (see Makefile), each copy
+//   filling a Kernels table with vectors of that ISA
+// - The table of the widest ISA supported by the CPU is picked on first use,
+//   so that one binary built for the x86-64 baseline still gets AVX2 or
+//   AVX-512 kernels on hosts that have them
+// - Override: SetISA(), or the environment variable PA_SIMD_ISA (sse2, avx2
+//   or avx512), e.g. to test the narrower kernels on a wide host
+enum class ISA {
+  kSSE2,
+  kAVX2,    // With FMA (x86-64-v3)
+  kAVX512,  // F, BW, CD, DQ and VL (x86-64-v4)
+  kMax,
+};
+
+struct Kernels {
+  ISA isa;
+  int width;
+  // Same as PeriodicTermComputeSIMD() (see utils.h)
+  double (*periodic_terms)(const PeriodicTermTable &table, double t) noexcept;
+  // sum(a[i] * sin(b[i] + c[i] * t)), or cos, for i < size
+  // - Indexed by PeriodicTermTable::Method
+  // - size: A multiple of kMaxWidth (see simd.h)
+  double (*series_sums[2])(const double *a, const double *b, const double *c,
+                           int size, double t) noexcept;
+  // Same, with the derivative w.r.t. t from the same sin/cos:
+  // sum(a[i] * c[i] * cos(b[i] + c[i] * t)), or -sum(a[i] * c[i] * sin(...))
+  void (*series_sums_with_rate[2])(const double *a, const double *b,
+                                   const double *c, int size, double t,
+                                   double *p_sum, double *p_rate_sum) noexcept;
+  // sums[k] = sum(a[i] * sin(b[i] + c[i] * ts[k])), or cos, for i < size and
+  // k < count: Each term is applied to a tile of epochs at once, so that the
+  // coefficients are loaded once per tile (see PeriodicSeries)
+  void (*series_batch_sums[2])(const double *a, const double *b,
+                               const double *c, int size, const double *ts,
+                               int count, double *sums) noexcept;
+  // sum(a[i] * sin(b[i] + c[i] * t)), or cos, for begin <= i < end, with the
+  // arguments reduced in double precision and the rest in single precision
+  // (see PeriodicSeries::MixedPrecision)
+  // - begin and end: Multiples of kMaxFloatWidth (see simd.h)
+  double (*float_series_sums[2])(const float *a, const double *b,
+                                 const double *c, int begin, int end,
+                                 double t) noexcept;
+  // sin_x[i] = sin(c[i] * t) and cos_x[i] = cos(c[i] * t), for i < size
+  // (see SharedFrequencySeries)
+  // - size: A multiple of kMaxWidth
+  void (*frequency_sincos)(const double *c, int size, double t, double *sin_x,
+                           double *cos_x) noexcept;
+  // sum(p[i] * cos_x[frequencies[i]] + q[i] * sin_x[frequencies[i]]), for
+  // i < size
+  // - size: A multiple of kMaxWidth
+  double (*frequency_sums)(const int *frequencies, const double *p,
+                           const double *q, int size, const double *sin_x,
+                           const double *cos_x) noexcept;
+  // Same as ELP82JM::Compute() over size epochs, with the rates: outputs[6]
+  // are the longitudes, latitudes, radius vectors (km) and their rates per
+  // day, each skipped if nullptr; longitudes and latitudes are not reduced
+  void (*elp82jm_positions)(const double *tts, int size,
+                            double *const *outputs) noexcept;
+  // Same as EarthNutation::ComputeNutationIAU1980() and
+  // ComputeNutationIAU2000B() over size epochs, each output skipped if nullptr
+  void (*nutation_iau1980)(const double *tts, int size, double *longitudes,
+                           double *obliquities) noexcept;
+  void (*nutation_iau2000b)(const double *tts, int size, double *longitudes,
+                            double *obliquities) noexcept;
+  // Same as EarthNutation::ComputeNutationIAU2000A() over size epochs, with
+  // the first term_count terms and the multiples up to max_multiples[a] of the
+  // arguments
+  void (*nutation_iau2000a)(const double *tts, int size, int term_count,
+                            const int *max_multiples, double *longitudes,
+                            double *obliquities) noexcept;
+};
+
+const Kernels &GetKernels() noexcept;
+
+const char *GetISAName(ISA isa) noexcept;
+// Whether both the CPU (and OS) and this build support the ISA
+bool IsISASupported(ISA isa) noexcept;
+// Forces the kernels of an ISA, or back to the default ones (PA_SIMD_ISA, else
+// the widest supported ISA) with ISA::kMax; false (and no change) if the ISA
+// is not supported
+bool SetISA(ISA isa) noexcept;
+
+}  // namespace SIMD
+}  // namespace PA
+
+#endif  // SIMD_DISPATCH_H_
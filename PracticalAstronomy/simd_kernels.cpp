@@ -0,0 +1,199 @@
+// Kernels of the run-time dispatch table (see simd_dispatch.h)
+// - Built once per ISA by the Makefile; each copy lands in the inline
+//   namespace of its ISA (see simd.h), and so does its table kKernels
+// - Only code of that namespace may be used here: An inline function of
+//   another namespace would be emitted with the vectors of this ISA, and the
+//   linker could pick that copy for the other translation units
+
+#include <cmath>
+
+#include "date.h"
+#include "earth_nutation.h"
+#include "elp82jm.h"
+#include "simd.h"
+#include "simd_dispatch.h"
+#include "utils.h"
+
+namespace PA {
+namespace SIMD {
+inline namespace PA_SIMD_ISA {
+
+namespace {
+
+template <PeriodicTermTable::Method kMethod>
+double SeriesSum(const double *a, const double *b, const double *c, int size,
+                 double t) noexcept {
+  VecD sum{};
+  for (int i = 0; i < size; i += kWidth) {
+    VecD arg{Load(b + i) + Load(c + i) * t};
+    if constexpr (kMethod == PeriodicTermTable::Method::kSin) {
+      sum += Load(a + i) * Sin(arg);
+    } else {
+      sum += Load(a + i) * Cos(arg);
+    }
+  }
+  return ReduceAdd(sum);
+}
+
+template <PeriodicTermTable::Method kMethod>
+void SeriesSumWithRate(const double *a, const double *b, const double *c,
+                       int size, double t, double *p_sum,
+                       double *p_rate_sum) noexcept {
+  VecD sum{};
+  VecD rate_sum{};
+  for (int i = 0; i < size; i += kWidth) {
+    VecD va{Load(a + i)};
+    VecD vc{Load(c + i)};
+    VecD s, co;
+    SinCos(Load(b + i) + vc * t, &s, &co);
+    if constexpr (kMethod == PeriodicTermTable::Method::kSin) {
+      sum += va * s;
+      rate_sum += va * vc * co;
+    } else {
+      sum += va * co;
+      rate_sum -= va * vc * s;
+    }
+  }
+  *p_sum = ReduceAdd(sum);
+  *p_rate_sum = ReduceAdd(rate_sum);
+}
+
+template <PeriodicTermTable::Method kMethod>
+void SeriesBatchSums(const double *a, const double *b, const double *c,
+                     int size, const double *ts, int count,
+                     double *sums) noexcept {
+  constexpr int kTileVectors{4};
+  constexpr int kTileSize{kTileVectors * kWidth};
+  for (int begin = 0; begin < count; begin += kTileSize) {
+    int tile_count{count - begin < kTileSize ? count - begin : kTileSize};
+    double tile_t[kTileSize];
+    for (int k = 0; k < kTileSize; k++) {
+      // Pad the last tile by repeating its last epoch
+      tile_t[k] = ts[begin + (k < tile_count ? k : tile_count - 1)];
+    }
+    VecD t[kTileVectors];
+    VecD sum[kTileVectors];
+    for (int j = 0; j < kTileVectors; j++) {
+      t[j] = Load(tile_t + j * kWidth);
+      sum[j] = VecD{};
+    }
+    for (int i = 0; i < size; i++) {
+      double ai{a[i]};
+      double bi{b[i]};
+      double ci{c[i]};
+      for (int j = 0; j < kTileVectors; j++) {
+        if constexpr (kMethod == PeriodicTermTable::Method::kSin) {
+          sum[j] += ai * Sin(bi + ci * t[j]);
+        } else {
+          sum[j] += ai * Cos(bi + ci * t[j]);
+        }
+      }
+    }
+    double tile_sum[kTileSize];
+    for (int j = 0; j < kTileVectors; j++) Store(tile_sum + j * kWidth, sum[j]);
+    for (int k = 0; k < tile_count; k++) sums[begin + k] = tile_sum[k];
+  }
+}
+
+template <PeriodicTermTable::Method kMethod>
+double FloatSeriesSum(const float *a, const double *b, const double *c,
+                      int begin, int end, double t) noexcept {
+  VecF sum{};
+  for (int i = begin; i < end; i += kFloatWidth) {
+    VecD arg_lo{Load(b + i) + Load(c + i) * t};
+    VecD arg_hi{Load(b + i + kWidth) + Load(c + i + kWidth) * t};
+    VecF arg{ConvertToFloat(ReduceTwoPi(arg_lo), ReduceTwoPi(arg_hi))};
+    if constexpr (kMethod == PeriodicTermTable::Method::kSin) {
+      sum += Load(a + i) * Sin(arg);
+    } else {
+      sum += Load(a + i) * Cos(arg);
+    }
+  }
+  return ReduceAdd(sum);
+}
+
+void FrequencySinCos(const double *c, int size, double t, double *sin_x,
+                     double *cos_x) noexcept {
+  for (int i = 0; i < size; i += kWidth) {
+    VecD s, co;
+    SinCos(Load(c + i) * t, &s, &co);
+    Store(sin_x + i, s);
+    Store(cos_x + i, co);
+  }
+}
+
+// Gathers: Scalar loads, in four chains so that they overlap
+// - The chains are named locals: As an array, the compiler may keep them in
+//   memory, each step then waiting on the store of the previous one
+double FrequencySums(const int *frequencies, const double *p, const double *q,
+                     int size, const double *sin_x,
+                     const double *cos_x) noexcept {
+  auto term{[&](int i) {
+    int f{frequencies[i]};
+    return p[i] * cos_x[f] + q[i] * sin_x[f];
+  }};
+  double sum0{0.0}, sum1{0.0}, sum2{0.0}, sum3{0.0};
+  for (int i = 0; i < size; i += 4) {
+    sum0 += term(i);
+    sum1 += term(i + 1);
+    sum2 += term(i + 2);
+    sum3 += term(i + 3);
+  }
+  return (sum0 + sum1) + (sum2 + sum3);
+}
+
+double PeriodicTerms(const PeriodicTermTable &table, double t) noexcept {
+  return ComputePeriodicTerms(table, t);
+}
+
+constexpr ISA GetKernelISA() noexcept {
+#if defined(__AVX512F__)
+  return ISA::kAVX512;
+#elif defined(__AVX2__)
+  return ISA::kAVX2;
+#else
+  return ISA::kSSE2;
+#endif
+}
+
+}  // namespace
+
+extern const Kernels kKernels{
+    GetKernelISA(),
+    kWidth,
+    PeriodicTerms,
+    {
+        [static_cast<int>(PeriodicTermTable::Method::kSin)] =
+            SeriesSum<PeriodicTermTable::Method::kSin>,
+        [static_cast<int>(PeriodicTermTable::Method::kCos)] =
+            SeriesSum<PeriodicTermTable::Method::kCos>,
+    },
+    {
+        [static_cast<int>(PeriodicTermTable::Method::kSin)] =
+            SeriesSumWithRate<PeriodicTermTable::Method::kSin>,
+        [static_cast<int>(PeriodicTermTable::Method::kCos)] =
+            SeriesSumWithRate<PeriodicTermTable::Method::kCos>,
+    },
+    {
+        [static_cast<int>(PeriodicTermTable::Method::kSin)] =
+            SeriesBatchSums<PeriodicTermTable::Method::kSin>,
+        [static_cast<int>(PeriodicTermTable::Method::kCos)] =
+            SeriesBatchSums<PeriodicTermTable::Method::kCos>,
+    },
+    {
+        [static_cast<int>(PeriodicTermTable::Method::kSin)] =
+            FloatSeriesSum<PeriodicTermTable::Method::kSin>,
+        [static_cast<int>(PeriodicTermTable::Method::kCos)] =
+            FloatSeriesSum<PeriodicTermTable::Method::kCos>,
+    },
+    FrequencySinCos,
+    FrequencySums,
+    ComputeELP82JM,
+    ComputeNutationIAU1980,
+    ComputeNutationIAU2000B,
+    ComputeNutationIAU2000A,
+};
+
+}  // namespace PA_SIMD_ISA
+}  // namespace SIMD
+}  // namespace PA
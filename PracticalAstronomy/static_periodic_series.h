@@ -0,0 +1,172 @@
+#ifndef STATIC_PERIODIC_SERIES_H_
+#define STATIC_PERIODIC_SERIES_H_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "simd.h"
+#include "simd_dispatch.h"
+#include "utils.h"
+
+namespace PA {
+
+namespace Internal {
+
+// Sum of the amplitudes below threshold
+constexpr double GetDroppedAmplitude(const PeriodicTermTable &table,
+                                     double threshold) noexcept {
+  double sum{0.0};
+  for (int degree = 0; degree < table.size; degree++) {
+    for (int i = 0; i < table.degrees[degree].size; i++) {
+      double a{std::fabs(table.degrees[degree].terms[i].a)};
+      if (a < threshold) sum += a;
+    }
+  }
+  return sum;
+}
+
+// The smallest amplitude to keep: Drops the smallest amplitudes (equal ones
+// together) as long as their sum stays within tolerance
+constexpr double GetTruncationThreshold(const PeriodicTermTable &table,
+                                        double tolerance) {
+  if (tolerance <= 0.0) return 0.0;
+  std::vector<double> amplitudes;
+  for (int degree = 0; degree < table.size; degree++) {
+    for (int i = 0; i < table.degrees[degree].size; i++) {
+      amplitudes.push_back(std::fabs(table.degrees[degree].terms[i].a));
+    }
+  }
+  std::sort(amplitudes.begin(), amplitudes.end());
+  double sum{0.0};
+  for (std::size_t i = 0; i < amplitudes.size();) {
+    double equal_sum{0.0};
+    std::size_t j{i};
+    for (; j < amplitudes.size() && amplitudes[j] == amplitudes[i]; j++) {
+      equal_sum += amplitudes[j];
+    }
+    if (sum + equal_sum > tolerance) return amplitudes[i];
+    sum += equal_sum;
+    i = j;
+  }
+  return std::numeric_limits<double>::infinity();
+}
+
+}  // namespace Internal
+
+// A PeriodicTermTable known at compile time, in structure-of-arrays form
+// - The degree count and the term count of each degree are constants, so that
+//   the degree loop is unrolled and each degree is summed over static, aligned
+//   arrays by the kernels of the host ISA (see simd_dispatch.h), whatever the
+//   ISA of the translation unit
+// - Truncation (kTolerance > 0): Keeps the terms of amplitude >= kThreshold,
+//   the largest threshold such that the dropped amplitudes sum within
+//   kTolerance, for |t| <= 1 (see PeriodicSeries::Truncation); the kept terms
+//   stay in the order of the table
+template <const PeriodicTermTable &kTable, double kTolerance = 0.0>
+class StaticPeriodicSeries {
+ public:
+  static constexpr std::size_t kAlignment{64};
+  static constexpr int kDegreeCount{kTable.size};
+  static constexpr PeriodicTermTable::Method kMethod{kTable.method};
+
+  // Terms of a degree, zero-padded to whole vectors of any ISA
+  template <int kSize>
+  struct alignas(kAlignment) Terms {
+    std::array<double, kSize> a;
+    std::array<double, kSize> b;
+    std::array<double, kSize> c;
+  };
+
+  static constexpr double kThreshold{
+      Internal::GetTruncationThreshold(kTable, kTolerance)};
+  // Worst-case truncation error w.r.t. the full table, for |t| <= 1
+  static constexpr double kErrorBound{
+      Internal::GetDroppedAmplitude(kTable, kThreshold)};
+
+  template <int kDegree>
+  static constexpr int kTermCount{[] {
+    const PeriodicTermTableDegree &degree{kTable.degrees[kDegree]};
+    int count{0};
+    for (int i = 0; i < degree.size; i++) {
+      if (!(std::fabs(degree.terms[i].a) < kThreshold)) count++;
+    }
+    return count;
+  }()};
+  template <int kDegree>
+  static constexpr int kPaddedSize{(kTermCount<kDegree> + SIMD::kMaxWidth - 1) /
+                                   SIMD::kMaxWidth * SIMD::kMaxWidth};
+  template <int kDegree>
+  static constexpr Terms<kPaddedSize<kDegree>> kTerms{[] {
+    const PeriodicTermTableDegree &degree{kTable.degrees[kDegree]};
+    Terms<kPaddedSize<kDegree>> terms{};
+    int k{0};
+    for (int i = 0; i < degree.size; i++) {
+      const PeriodicTerm &pt{degree.terms[i]};
+      if (std::fabs(pt.a) < kThreshold) continue;
+      terms.a[k] = pt.a;
+      terms.b[k] = pt.b;
+      terms.c[k] = pt.c;
+      k++;
+    }
+    return terms;
+  }()};
+
+  // Vectorized at run time, scalar when evaluated as a constant expression
+  // - Accuracy: kErrorBound, plus PeriodicTermComputeSIMDErrorBound() (see
+  //   utils.h)
+  static constexpr double Compute(double t) noexcept {
+    return Compute(t, std::make_integer_sequence<int, kDegreeCount>{});
+  }
+
+ private:
+  template <int kDegree>
+  static constexpr double ComputeDegreeScalar(double t) noexcept {
+    const auto &terms{kTerms<kDegree>};
+    double sum{0.0};
+    for (int i = 0; i < kTermCount<kDegree>; i++) {
+      if constexpr (kMethod == PeriodicTermTable::Method::kSin) {
+        sum += terms.a[i] * std::sin(terms.b[i] + terms.c[i] * t);
+      } else {
+        sum += terms.a[i] * std::cos(terms.b[i] + terms.c[i] * t);
+      }
+    }
+    return sum;
+  }
+
+  template <int kDegree>
+  static inline double ComputeDegree(const SIMD::Kernels &kernels,
+                                     double t) noexcept {
+    const auto &terms{kTerms<kDegree>};
+    return kernels.series_sums[static_cast<int>(kMethod)](
+        terms.a.data(), terms.b.data(), terms.c.data(), kPaddedSize<kDegree>,
+        t);
+  }
+
+  // Horner scheme, from the highest degree
+  template <int... kDegrees>
+  static constexpr double Compute(
+      double t, std::integer_sequence<int, kDegrees...>) noexcept {
+    double value{0.0};
+    if (std::is_constant_evaluated()) {
+      ((value = value * t +
+                ComputeDegreeScalar<kDegreeCount - 1 - kDegrees>(t)),
+       ...);
+    } else {
+      const SIMD::Kernels &kernels{SIMD::GetKernels()};
+      ((value = value * t +
+                ComputeDegree<kDegreeCount - 1 - kDegrees>(kernels, t)),
+       ...);
+    }
+    return value;
+  }
+};
+
+}  // namespace PA
+
+#endif  // STATIC_PERIODIC_SERIES_H_
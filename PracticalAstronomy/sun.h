@@ -1,6 +1,9 @@
 #ifndef SUN_H_
 #define SUN_H_
 
+#include <cstdint>
+
+#include "periodic_term_stepper.h"
 #include "radian.h"
 #include "utils.h"
 
@@ -8,21 +11,46 @@ namespace PA {
 class Sun {
  public:
   static constexpr double GetDailyVariation(double tt) noexcept;
+  static constexpr const PeriodicTermTable &GetDailyVariationTable() noexcept {
+    return variation_d_table;
+  }
+
+  // GetDailyVariation() on the uniform grid tt_n = tt_begin + n * step_days,
+  // n = 0, 1, ... (see PeriodicTermStepper)
+  class DailyVariationStepper {
+   public:
+    DailyVariationStepper(
+        double tt_begin, double step_days,
+        int reseed_interval = PeriodicTermStepper::kDefaultReseedInterval)
+        : tt_begin_(tt_begin),
+          step_days_(step_days),
+          stepper_(variation_d_table, (tt_begin - EpochJ2000) / 365250.0,
+                   step_days / 365250.0, reseed_interval) {}
+
+    double GetTT() const noexcept { return tt_begin_ + step_ * step_days_; }
+    double Compute() const noexcept {
+      return kDailyVariationConstant + stepper_.Compute();
+    }
+    void Step() noexcept {
+      step_++;
+      stepper_.Step();
+    }
+
+   private:
+    double tt_begin_;
+    double step_days_;
+    int64_t step_{0};
+    PeriodicTermStepper stepper_;
+  };
 
   // constexpr double GetMeanLongitude() noexcept;
 
  private:
   constexpr Sun() noexcept;
 
-  // constexpr void ComputeMeanLongitude() noexcept;
-  // bool mean_longitude_is_valid_{false};
-  // double mean_longitude_{0.0};
-};
-
-constexpr double Sun::GetDailyVariation(double tt) noexcept {
   // [Jean99] pp.167-168
   // Accuracy: <= 0".1
-  constexpr struct PeriodicTerm variation_d0[]{
+  static constexpr struct PeriodicTerm variation_d0[]{
       // Eccentricity of Earth's orbit
       {118.568_arcsec, 87.5287_deg, 359993.7286_deg},
       // Eccentricity of Earth's orbit
@@ -52,7 +80,7 @@ constexpr double Sun::GetDailyVariation(double tt) noexcept {
       // Due to Venus
       {0.021_arcsec, 155.1241_deg, 675553.2846_deg},
   };
-  constexpr struct PeriodicTerm variation_d1[]{
+  static constexpr struct PeriodicTerm variation_d1[]{
       // Eccentricity of Earth's orbit
       {7.311_arcsec, 333.4515_deg, 359993.7286_deg},
       // Eccentricity of Earth's orbit
@@ -60,7 +88,7 @@ constexpr double Sun::GetDailyVariation(double tt) noexcept {
       // Eccentricity of Earth's orbit
       {0.010_arcsec, 328.5170_deg, 1079981.1857_deg},
   };
-  constexpr struct PeriodicTerm variation_d2[]{
+  static constexpr struct PeriodicTerm variation_d2[]{
       // Eccentricity of Earth's orbit
       {0.309_arcsec, 241.4518_deg, 359993.7286_deg},
       // Eccentricity of Earth's orbit
@@ -68,28 +96,36 @@ constexpr double Sun::GetDailyVariation(double tt) noexcept {
       // Due to Moon
       {0.004_arcsec, 297.8610_deg, 4452671.1152_deg},
   };
-  constexpr struct PeriodicTerm variation_d3[]{
+  static constexpr struct PeriodicTerm variation_d3[]{
       // Eccentricity of Earth's orbit
       {0.010_arcsec, 154.7066_deg, 359993.7286_deg},
   };
-  const struct PeriodicTermTableDegree variation_d_table_degrees[]{
+  static constexpr struct PeriodicTermTableDegree variation_d_table_degrees[]{
       {variation_d0, sizeof(variation_d0) / sizeof(variation_d0[0])},
       {variation_d1, sizeof(variation_d1) / sizeof(variation_d1[0])},
       {variation_d2, sizeof(variation_d2) / sizeof(variation_d2[0])},
       {variation_d3, sizeof(variation_d3) / sizeof(variation_d3[0])},
   };
-  const struct PeriodicTermTable variation_d_table {
+  static constexpr struct PeriodicTermTable variation_d_table {
     .degrees = variation_d_table_degrees,
     .size = sizeof(variation_d_table_degrees) /
             sizeof(variation_d_table_degrees[0]),
     .method = PeriodicTermTable::Method::kSin,
   };
 
-  double tau{(tt - EpochJ2000) / 365250.0};
   // For value:
   // - w.r.t. fixed reference frame: Use 3548.193_arcsec
   // - w.r.t. the mean equinox of the date: Use 3548.330_arcsec
-  return 3548.193_arcsec + PeriodicTermCompute(variation_d_table, tau);
+  static constexpr double kDailyVariationConstant{3548.193_arcsec};
+
+  // constexpr void ComputeMeanLongitude() noexcept;
+  // bool mean_longitude_is_valid_{false};
+  // double mean_longitude_{0.0};
+};
+
+constexpr double Sun::GetDailyVariation(double tt) noexcept {
+  double tau{(tt - EpochJ2000) / 365250.0};
+  return kDailyVariationConstant + PeriodicTermCompute(variation_d_table, tau);
 }
 
 #if 0
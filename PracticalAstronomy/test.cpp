@@ -1,6 +1,15 @@
 #include "test.h"
 
+#include <atomic>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 #include "date.h"
 #include "observer.h"
@@ -193,6 +202,221 @@ static void test_nutation_obliquity() {
   }
 
   std::cout << "OK!" << std::endl;
+
+  std::cout << "Earth: Nutation Series... ";
+  {
+    // Sums of the tables with the sin/cos of libm, term by term
+    // - The first count terms (all if 0)
+    auto reference{[](const auto& terms, const auto& arguments, double tt,
+                      double* p_longitude, double* p_obliquity,
+                      std::size_t count = 0) {
+      std::size_t argument_count{std::size(arguments)};
+      double t{(tt - EpochJ2000) / 36525.0};
+      double x[EarthNutation::kArgumentCountIAU2000A];
+      for (std::size_t a = 0; a < argument_count; a++) {
+        x[a] = horner_polynomial(arguments[a], t);
+      }
+      if (count == 0) count = std::size(terms.psi_sin);
+      double sum_dpsi{0.0}, sum_deps{0.0};
+      for (std::size_t i = 0; i < count; i++) {
+        double arg{0.0};
+        for (std::size_t a = 0; a < argument_count; a++) {
+          arg += terms.multipliers[a][i] * x[a];
+        }
+        sum_dpsi +=
+            (terms.psi_sin[i] + terms.psi_t_sin[i] * t) * std::sin(arg) +
+            (terms.psi_cos[i] + terms.psi_t_cos[i] * t) * std::cos(arg);
+        sum_deps +=
+            (terms.eps_cos[i] + terms.eps_t_cos[i] * t) * std::cos(arg) +
+            (terms.eps_sin[i] + terms.eps_t_sin[i] * t) * std::sin(arg);
+      }
+      *p_longitude = sum_dpsi / terms.divisor;
+      *p_obliquity = sum_deps / terms.divisor;
+    }};
+    // An odd count, for a partial last vector
+    std::vector<double> tts;
+    for (int i = 0; i < 37; i++) tts.push_back(EpochJ1900 + i * 2017.3);
+    std::size_t size{tts.size()};
+    for (int i = 0; i < static_cast<int>(SIMD::ISA::kMax); i++) {
+      if (!SIMD::SetISA(static_cast<SIMD::ISA>(i))) continue;
+      std::vector<double> lons1980(size), obls1980(size);
+      std::vector<double> lons2000(size), obls2000(size);
+      EarthNutation::ComputeNutationIAU1980(tts, lons1980, obls1980);
+      EarthNutation::ComputeNutationIAU2000B(tts, lons2000, obls2000);
+      for (std::size_t k = 0; k < size; k++) {
+        double lon, obl, lon_ref, obl_ref;
+        EarthNutation::ComputeNutationIAU1980(tts[k], &lon, &obl);
+        reference(EarthNutation::kTermsIAU1980,
+                  EarthNutation::kArgumentsIAU1980, tts[k], &lon_ref, &obl_ref);
+        expect_double(lon, lon_ref, 0.0, 1.0e-14);
+        expect_double(obl, obl_ref, 0.0, 1.0e-14);
+        expect_double(lons1980[k], lon, 0.0, 1.0e-14);
+        expect_double(obls1980[k], obl, 0.0, 1.0e-14);
+        EarthNutation::ComputeNutationIAU2000B(tts[k], &lon, &obl);
+        reference(EarthNutation::kTermsIAU2000B,
+                  EarthNutation::kArgumentsIAU2000B, tts[k], &lon_ref,
+                  &obl_ref);
+        expect_double(lon, lon_ref, 0.0, 1.0e-14);
+        expect_double(obl, obl_ref, 0.0, 1.0e-14);
+        expect_double(lons2000[k], lon, 0.0, 1.0e-14);
+        expect_double(obls2000[k], obl, 0.0, 1.0e-14);
+      }
+    }
+    expect_bool(SIMD::SetISA(SIMD::ISA::kMax), true);
+
+    // Truncation: The dropped terms stay within the tolerance over 1900-2100
+    const auto& terms{EarthNutation::kTermsIAU2000B};
+    constexpr auto kFull{EarthNutation::GetTruncation(terms, 0.0)};
+    static_assert(kFull.term_count == 77);
+    for (int multiple : kFull.max_multiples) {
+      expect_bool(multiple > 0 && multiple <= EarthNutation::kMaxMultiple,
+                  true);
+    }
+    constexpr int kCount{
+        EarthNutation::GetTruncation(terms, 0.001_arcsec).term_count};
+    static_assert(kCount > 0 && kCount < 77);
+    static_assert(
+        EarthNutation::GetTruncation(terms, 0.01_arcsec).term_count <= kCount);
+    for (double tt = EpochJ1900; tt <= EpochJ2000 + 36525.0; tt += 3652.5) {
+      double lon, obl, lon_truncated, obl_truncated;
+      reference(terms, EarthNutation::kArgumentsIAU2000B, tt, &lon, &obl);
+      reference(terms, EarthNutation::kArgumentsIAU2000B, tt, &lon_truncated,
+                &obl_truncated, kCount);
+      expect_double(lon_truncated, lon, 0.0, 0.001_arcsec);
+      expect_double(obl_truncated, obl, 0.0, 0.001_arcsec);
+    }
+
+    // IAU 2000A
+    {
+      // ERFA eraNut00a() (pyerfa 2.0.1.5) every 25 years over 1900-2100, and
+      // at MJD 53736 of t_sofa_c.c: Its planetary terms use simplified
+      // arguments, within 0.0000001" of the full ones; a term lost or doubled
+      // in the merge of the tables would show above that
+      static constexpr double kReferences[][3]{
+          {15020.0, 8.4520648962990995e-05, -1.1102960658473682e-05},
+          {24151.5, -5.6490805869883638e-05, -3.4083907060231015e-05},
+          {33282.0, -1.6014246657565489e-05, 4.0351623057366002e-05},
+          {42413.0, 8.1642118342445302e-05, -1.8477419219481679e-05},
+          {51544.5, -6.7544224264172976e-05, -2.7970831192374137e-05},
+          {53736.0, -9.6309091071164243e-06, 4.0632391740016646e-05},
+          {60676.0, 9.5695377654172769e-07, 4.1227898432897594e-05},
+          {69807.0, 7.3553469652806166e-05, -2.5839215834704744e-05},
+          {78938.0, -7.4673655339507509e-05, -2.1186035217193558e-05},
+          {88069.0, 1.5942650501397432e-05, 4.1521096095134601e-05},
+      };
+      for (const auto& [mjd, lon_ref, obl_ref] : kReferences) {
+        double lon, obl;
+        EarthNutation::ComputeNutationIAU2000A(2400000.5 + mjd, &lon, &obl);
+        expect_double(lon, lon_ref, 0.0, 0.0000001_arcsec);
+        expect_double(obl, obl_ref, 0.0, 0.0000001_arcsec);
+      }
+      // The 1365 terms of nut00a, merged by multipliers
+      expect_bool(EarthNutation::GetTermCountIAU2000A(
+                      EarthNutation::Accuracy::kFull) == 1323,
+                  true);
+    }
+    constexpr double kTolerances[]{0.0, 0.0001_arcsec, 0.001_arcsec,
+                                   0.01_arcsec};
+    for (int a = 0; a < static_cast<int>(EarthNutation::Accuracy::kMax); a++) {
+      EarthNutation::Accuracy accuracy{static_cast<EarthNutation::Accuracy>(a)};
+      int count{EarthNutation::GetTermCountIAU2000A(accuracy)};
+      expect_bool(count > 0, true);
+      if (a > 0) {
+        expect_bool(count <= EarthNutation::GetTermCountIAU2000A(
+                                 static_cast<EarthNutation::Accuracy>(a - 1)),
+                    true);
+      }
+      for (int i = 0; i < static_cast<int>(SIMD::ISA::kMax); i++) {
+        if (!SIMD::SetISA(static_cast<SIMD::ISA>(i))) continue;
+        std::vector<double> lons(size), obls(size);
+        EarthNutation::ComputeNutationIAU2000A(tts, lons, obls, accuracy);
+        for (std::size_t k = 0; k < size; k++) {
+          double lon, obl, lon_ref, obl_ref;
+          EarthNutation::ComputeNutationIAU2000A(tts[k], &lon, &obl, accuracy);
+          reference(EarthNutation::kTermsIAU2000A,
+                    EarthNutation::kArgumentsIAU2000A, tts[k], &lon_ref,
+                    &obl_ref, count);
+          expect_double(lon, lon_ref, 0.0, 1.0e-14);
+          expect_double(obl, obl_ref, 0.0, 1.0e-14);
+          expect_double(lons[k], lon, 0.0, 1.0e-14);
+          expect_double(obls[k], obl, 0.0, 1.0e-14);
+          reference(EarthNutation::kTermsIAU2000A,
+                    EarthNutation::kArgumentsIAU2000A, tts[k], &lon_ref,
+                    &obl_ref);
+          if (std::fabs(tts[k] - EpochJ2000) <= 36525.0) {
+            expect_double(lon, lon_ref, 0.0, kTolerances[a] + 1.0e-14);
+            expect_double(obl, obl_ref, 0.0, kTolerances[a] + 1.0e-14);
+          }
+          // IAU 2000B: Within 0.001" of IAU 2000A in 1995-2050
+          if (tts[k] >= Date{1995, 1, 1.0}.GetJulianDate() &&
+              tts[k] <= Date{2050, 1, 1.0}.GetJulianDate()) {
+            EarthNutation::ComputeNutationIAU2000B(tts[k], &lon_ref, &obl_ref);
+            expect_double(lon, lon_ref, 0.0, 0.001_arcsec + kTolerances[a]);
+            expect_double(obl, obl_ref, 0.0, 0.001_arcsec + kTolerances[a]);
+          }
+        }
+      }
+      expect_bool(SIMD::SetISA(SIMD::ISA::kMax), true);
+    }
+  }
+  std::cout << "OK!" << std::endl;
+
+  std::cout << "Earth: Nutation Table... ";
+  {
+    double tt_begin{Date{1990, 1, 1.0}.GetJulianDate()};
+    double tt_end{Date{2010, 1, 1.0}.GetJulianDate()};
+    NutationTable table{NutationTable::Build(tt_begin, tt_end)};
+    expect_bool(table.GetErrorBound() < 0.0001_arcsec, true);
+    expect_bool(table.GetMaxError() <= table.GetErrorBound(), true);
+    // Epochs off the nodes and the middles
+    for (double tt = tt_begin; tt <= tt_end; tt += 1.37) {
+      double lon, obl, lon_series, obl_series;
+      expect_bool(table.Compute(tt, &lon, &obl), true);
+      EarthNutation::ComputeNutationIAU2000B(tt, &lon_series, &obl_series);
+      expect_double(lon, lon_series, 0.0, table.GetErrorBound());
+      expect_double(obl, obl_series, 0.0, table.GetErrorBound());
+    }
+    expect_bool(table.Compute(tt_end, nullptr, nullptr), true);
+    expect_bool(table.Compute(tt_begin - 1.0, nullptr, nullptr), false);
+    expect_bool(table.Compute(tt_end + 1.0, nullptr, nullptr), false);
+    // A coarser grid: A larger bound, which still holds
+    NutationTable coarse{NutationTable::Build(tt_begin, tt_end, 2.0)};
+    expect_bool(coarse.GetErrorBound() > table.GetErrorBound(), true);
+    expect_bool(coarse.GetMaxError() <= coarse.GetErrorBound(), true);
+    // Empty tables: Default, and from invalid ranges or steps
+    expect_bool(NutationTable{}.Compute(0.0, nullptr, nullptr), false);
+    for (double step : {0.0, -1.0, std::nan("")}) {
+      NutationTable empty{NutationTable::Build(tt_begin, tt_end, step)};
+      expect_bool(empty.Compute(tt_begin, nullptr, nullptr), false);
+    }
+    NutationTable reversed{NutationTable::Build(tt_end, tt_begin)};
+    expect_bool(reversed.Compute(tt_begin, nullptr, nullptr) ||
+                    reversed.Compute(tt_end, nullptr, nullptr),
+                false);
+
+    // Observer, also on the threads of a pool and outside the table
+    Observer observer{EpochJ2000};
+    observer.SetNutationAlgorithm(Observer::NutationAlgorithm::kInterpolated);
+    observer.SetNutationTable(&table);
+    double tts[]{tt_begin + 100.3, tt_end - 0.1, tt_end + 10.0};
+    double lons[3], obls[3];
+    ThreadPool pool{ThreadPool::Options{2, false}};
+    observer.ComputeNutation(pool, tts, lons, obls);
+    for (int i = 0; i < 3; i++) {
+      double lon, obl;
+      if (!table.Compute(tts[i], &lon, &obl)) {
+        EarthNutation::ComputeNutationIAU2000B(tts[i], &lon, &obl);
+      }
+      expect_bool(lons[i] == lon && obls[i] == obl, true);
+      Observer o{tts[i]};
+      o.SetNutationAlgorithm(Observer::NutationAlgorithm::kInterpolated);
+      o.SetNutationTable(&table);
+      expect_bool(o.GetNutationLongitude() == lon &&
+                      o.GetNutationObliquity() == obl,
+                  true);
+    }
+  }
+  std::cout << "OK!" << std::endl;
 }
 
 static void test_sun() {
@@ -265,6 +489,733 @@ static void test_moon() {
   }
 
   std::cout << "OK!" << std::endl;
+
+  std::cout << "Moon: Batch... ";
+  {
+    // An odd count, for a partial last vector
+    std::vector<double> tts;
+    for (int i = 0; i < 37; i++) tts.push_back(EpochJ1900 + i * 2017.3);
+    std::size_t size{tts.size()};
+    for (int i = 0; i < static_cast<int>(SIMD::ISA::kMax); i++) {
+      if (!SIMD::SetISA(static_cast<SIMD::ISA>(i))) continue;
+      std::vector<double> values[6];
+      for (auto& v : values) v.resize(size);
+      ELP82JM::Compute(tts, values[0], values[1], values[2], values[3],
+                       values[4], values[5]);
+      for (std::size_t k = 0; k < size; k++) {
+        double lon, lat, r;
+        ELP82JM::Compute(tts[k], &lon, &lat, &r);
+        // Up to a few ulps of the arguments (thousands of radians), as the
+        // wider ISAs contract to FMA
+        expect_double(values[0][k], lon, 0.0, 1.0e-11);
+        expect_double(values[1][k], lat, 0.0, 1.0e-11);
+        expect_double(values[2][k], r, 0.0, 1.0e-7);
+        // Rates against central differences, which are off by about
+        // kStep^2 / 6 times the third derivatives
+        constexpr double kStep{0.01};
+        double lon0, lat0, r0, lon1, lat1, r1;
+        ELP82JM::Compute(tts[k] - kStep, &lon0, &lat0, &r0);
+        ELP82JM::Compute(tts[k] + kStep, &lon1, &lat1, &r1);
+        expect_double(values[3][k], RadNormalize(lon1 - lon0) / (2.0 * kStep),
+                      1.0e-6, 0.0);
+        expect_double(values[4][k], (lat1 - lat0) / (2.0 * kStep), 0.0,
+                      1.0e-7);
+        expect_double(values[5][k], (r1 - r0) / (2.0 * kStep), 0.0, 0.02);
+      }
+      // Skipped outputs
+      std::vector<double> lats(size);
+      ELP82JM::Compute(tts, {}, lats, {});
+      expect_bool(lats == values[1], true);
+    }
+    expect_bool(SIMD::SetISA(SIMD::ISA::kMax), true);
+  }
+  std::cout << "OK!" << std::endl;
+}
+
+static void test_simd() {
+  std::cout << "SIMD: Sine and Cosine... ";
+  {
+    // Against long double, up to kSinCosMaxArgument and beyond (libm), with
+    // arguments near multiples of pi/2 where the reduction is the hardest;
+    // the scalar forms give the same results as the lanes
+    for (double x = -6.0e7; x <= 6.0e7; x += 1234.5678) {
+      for (int i = 0; i < 2; i++) {
+        double arg{i == 0 ? x
+                          : static_cast<double>(
+                                std::round(x / (M_PIl / 2.0)) * (M_PIl / 2.0))};
+        double s, c;
+        SIMD::SinCos(arg, &s, &c);
+        expect_double(s, sinl(arg), 0.0, 0x1.0p-51);
+        expect_double(c, cosl(arg), 0.0, 0x1.0p-51);
+        expect_bool(SIMD::Sin(arg) == s && SIMD::Cos(arg) == c, true);
+        SIMD::VecD sin_v, cos_v;
+        SIMD::SinCos(SIMD::Broadcast(arg), &sin_v, &cos_v);
+        expect_bool(sin_v[0] == s && cos_v[0] == c, true);
+      }
+    }
+    static_assert(SIMD::Sin(0.5) == std::sin(0.5));
+  }
+  std::cout << "OK!" << std::endl;
+}
+
+static void test_vsop87() {
+  std::cout << "VSOP87: SIMD Kernel... ";
+  {
+    double tts[]{EpochJ2000 - 730500.0, EpochJ1900, Date{1992, 10, 13.0}.GetJulianDate(),
+                 EpochJ2000 + 36525.0 * 3.3, EpochJ2000 + 730500.0};
+    for (int p = 0; p < static_cast<int>(VSOP87::Planet::kMax); p++) {
+      for (int v = 0; v < static_cast<int>(VSOP87::Variable::kMax); v++) {
+        const PeriodicTermTable& table{VSOP87::GetTable(
+            static_cast<VSOP87::Planet>(p), static_cast<VSOP87::Variable>(v))};
+        for (double tt : tts) {
+          double tau{(tt - EpochJ2000) / 365250.0};
+          expect_double(PeriodicTermComputeSIMD(table, tau),
+                        PeriodicTermComputeScalar(table, tau), 0.0,
+                        PeriodicTermComputeSIMDErrorBound(table, tau));
+          expect_double(VSOP87::GetSeries(static_cast<VSOP87::Planet>(p),
+                                          static_cast<VSOP87::Variable>(v))
+                            .Compute(tau),
+                        PeriodicTermComputeScalar(table, tau), 0.0,
+                        PeriodicTermComputeSIMDErrorBound(table, tau));
+        }
+      }
+    }
+  }
+  std::cout << "OK!" << std::endl;
+
+  std::cout << "VSOP87: ISA Dispatch... ";
+  {
+    double tts[]{EpochJ1900, EpochJ2000 + 36525.0 * 7.7};
+    expect_bool(SIMD::IsISASupported(SIMD::ISA::kSSE2), true);
+    for (int i = 0; i < static_cast<int>(SIMD::ISA::kMax); i++) {
+      SIMD::ISA isa{static_cast<SIMD::ISA>(i)};
+      if (!SIMD::SetISA(isa)) continue;
+      expect_bool(SIMD::GetKernels().isa == isa, true);
+      for (int p = 0; p < static_cast<int>(VSOP87::Planet::kMax); p++) {
+        VSOP87::Planet planet{static_cast<VSOP87::Planet>(p)};
+        for (double tt : tts) {
+          double tau{(tt - EpochJ2000) / 365250.0};
+          double values[3], rates[3];
+          VSOP87::Compute(tt, planet, &values[0], &values[1], &values[2]);
+          VSOP87::ComputeWithRates(tt, planet, &values[0], &values[1],
+                                   &values[2], &rates[0], &rates[1],
+                                   &rates[2]);
+          for (int v = 0; v < 3; v++) {
+            VSOP87::Variable variable{static_cast<VSOP87::Variable>(v)};
+            const PeriodicTermTable& table{VSOP87::GetTable(planet, variable)};
+            double scalar{PeriodicTermComputeScalar(table, tau)};
+            double bound{PeriodicTermComputeSIMDErrorBound(table, tau)};
+            expect_double(PeriodicTermCompute(table, tau), scalar, 0.0, bound);
+            expect_double(VSOP87::GetSeries(planet, variable).Compute(tau),
+                          scalar, 0.0, bound);
+            expect_double(values[v], scalar, 0.0, bound);
+          }
+        }
+      }
+    }
+    expect_bool(SIMD::SetISA(SIMD::ISA::kMax), true);
+  }
+  std::cout << "OK!" << std::endl;
+
+  std::cout << "VSOP87: ISA Dispatch (Batch, Mixed Precision)... ";
+  {
+    std::vector<double> tts;
+    for (int i = 0; i < 37; i++) tts.push_back(EpochJ1900 + 2345.6 * i);
+    std::vector<double> values(tts.size());
+    for (int i = 0; i < static_cast<int>(SIMD::ISA::kMax); i++) {
+      if (!SIMD::SetISA(static_cast<SIMD::ISA>(i))) continue;
+      for (int p = 0; p < static_cast<int>(VSOP87::Planet::kMax); p++) {
+        VSOP87::Planet planet{static_cast<VSOP87::Planet>(p)};
+        for (int v = 0; v < 3; v++) {
+          VSOP87::Variable variable{static_cast<VSOP87::Variable>(v)};
+          const PeriodicTermTable& table{VSOP87::GetTable(planet, variable)};
+          const PeriodicSeries& series{VSOP87::GetSeries(planet, variable)};
+          const PeriodicSeries::Truncation& truncation{VSOP87::GetTruncation(
+              planet, variable, VSOP87::Accuracy::k1ArcSec)};
+          const PeriodicSeries::MixedPrecision& mixed{
+              VSOP87::GetMixedPrecision(planet, variable,
+                                        VSOP87::Accuracy::k1ArcSec)};
+          std::vector<double> taus;
+          for (double tt : tts) taus.push_back((tt - EpochJ2000) / 365250.0);
+          series.Compute(taus, values);
+          for (std::size_t k = 0; k < tts.size(); k++) {
+            double scalar{PeriodicTermComputeScalar(table, taus[k])};
+            expect_double(values[k], scalar, 0.0,
+                          PeriodicTermComputeSIMDErrorBound(table, taus[k]));
+          }
+          series.Compute(taus, values, &truncation);
+          for (std::size_t k = 0; k < tts.size(); k++) {
+            double scalar{PeriodicTermComputeScalar(table, taus[k])};
+            double bound{PeriodicTermComputeSIMDErrorBound(table, taus[k])};
+            expect_double(values[k], scalar, 0.0,
+                          truncation.error_bound + bound);
+            expect_double(series.Compute(taus[k], mixed), scalar, 0.0,
+                          mixed.error_bound + bound);
+          }
+        }
+      }
+    }
+    expect_bool(SIMD::SetISA(SIMD::ISA::kMax), true);
+  }
+  std::cout << "OK!" << std::endl;
+
+  std::cout << "VSOP87: Merged Tables... ";
+  {
+    double tts[]{EpochJ1900, Date{1992, 10, 13.0}.GetJulianDate(),
+                 EpochJ2000 + 36525.0 * 7.7};
+    for (int p = 0; p < static_cast<int>(VSOP87::Planet::kMax); p++) {
+      VSOP87::Planet planet{static_cast<VSOP87::Planet>(p)};
+      for (double tt : tts) {
+        double tau{(tt - EpochJ2000) / 365250.0};
+        double values[6];
+        VSOP87::ComputeWithEarth(tt, planet, &values[0], &values[1],
+                                 &values[2], &values[3], &values[4],
+                                 &values[5]);
+        for (int v = 0; v < 6; v++) {
+          const PeriodicTermTable& table{VSOP87::GetTable(
+              v < 3 ? planet : VSOP87::Planet::kEarth,
+              static_cast<VSOP87::Variable>(v % 3))};
+          expect_double(values[v], PeriodicTermComputeScalar(table, tau), 0.0,
+                        PeriodicTermComputeSIMDErrorBound(table, tau));
+        }
+      }
+    }
+  }
+  std::cout << "OK!" << std::endl;
+
+  std::cout << "VSOP87: Shared Frequencies... ";
+  {
+    double tts[]{EpochJ2000 - 365250.0, EpochJ1900,
+                 Date{1992, 10, 13.0}.GetJulianDate(),
+                 EpochJ2000 + 36525.0 * 7.7};
+    for (int i = 0; i < static_cast<int>(SIMD::ISA::kMax); i++) {
+      if (!SIMD::SetISA(static_cast<SIMD::ISA>(i))) continue;
+      for (int p = 0; p < static_cast<int>(VSOP87::Planet::kMax); p++) {
+        VSOP87::Planet planet{static_cast<VSOP87::Planet>(p)};
+        expect_bool(
+            VSOP87::GetSharedFrequencySeries(planet).GetTableCount() == 3,
+            true);
+        for (double tt : tts) {
+          double tau{(tt - EpochJ2000) / 365250.0};
+          double values[3];
+          VSOP87::Compute(tt, planet, &values[0], &values[1], &values[2]);
+          for (int v = 0; v < 3; v++) {
+            const PeriodicTermTable& table{
+                VSOP87::GetTable(planet, static_cast<VSOP87::Variable>(v))};
+            expect_double(values[v], PeriodicTermComputeScalar(table, tau), 0.0,
+                          2.0 * PeriodicTermComputeSIMDErrorBound(table, tau));
+          }
+        }
+      }
+    }
+    expect_bool(SIMD::SetISA(SIMD::ISA::kMax), true);
+  }
+  std::cout << "OK!" << std::endl;
+
+  std::cout << "VSOP87: Static Tables... ";
+  {
+    double tts[]{EpochJ2000 - 365250.0, EpochJ1900,
+                 EpochJ2000 + 36525.0 * 7.7};
+    auto test_planet{[&tts]<VSOP87::Planet kPlanet, VSOP87::Accuracy kAccuracy>() {
+      for (double tt : tts) {
+        double tau{(tt - EpochJ2000) / 365250.0};
+        double values[3];
+        VSOP87::Compute<kPlanet, kAccuracy>(tt, &values[0], &values[1],
+                                            &values[2]);
+        double static_values[]{
+            VSOP87::StaticSeries<kPlanet, VSOP87::Variable::kLongitude,
+                                 kAccuracy>::Compute(tau),
+            VSOP87::StaticSeries<kPlanet, VSOP87::Variable::kLatitude,
+                                 kAccuracy>::Compute(tau),
+            VSOP87::StaticSeries<kPlanet, VSOP87::Variable::kRadiusVector,
+                                 kAccuracy>::Compute(tau),
+        };
+        double error_bounds[]{
+            VSOP87::StaticSeries<kPlanet, VSOP87::Variable::kLongitude,
+                                 kAccuracy>::kErrorBound,
+            VSOP87::StaticSeries<kPlanet, VSOP87::Variable::kLatitude,
+                                 kAccuracy>::kErrorBound,
+            VSOP87::StaticSeries<kPlanet, VSOP87::Variable::kRadiusVector,
+                                 kAccuracy>::kErrorBound,
+        };
+        for (int v = 0; v < 3; v++) {
+          const PeriodicTermTable& table{
+              VSOP87::GetTable(kPlanet, static_cast<VSOP87::Variable>(v))};
+          double scalar{PeriodicTermComputeScalar(table, tau)};
+          double bound{PeriodicTermComputeSIMDErrorBound(table, tau)};
+          expect_double(static_values[v], scalar, 0.0,
+                        bound + error_bounds[v]);
+          // kFull: From the shared frequencies (see SharedFrequencySeries)
+          expect_double(values[v], scalar, 0.0, 2.0 * bound + error_bounds[v]);
+        }
+      }
+    }};
+    for (int i = 0; i < static_cast<int>(SIMD::ISA::kMax); i++) {
+      if (!SIMD::SetISA(static_cast<SIMD::ISA>(i))) continue;
+      test_planet
+          .operator()<VSOP87::Planet::kMercury, VSOP87::Accuracy::kFull>();
+      test_planet.operator()<VSOP87::Planet::kEarth, VSOP87::Accuracy::kFull>();
+      test_planet
+          .operator()<VSOP87::Planet::kNeptune, VSOP87::Accuracy::kFull>();
+      test_planet
+          .operator()<VSOP87::Planet::kMars, VSOP87::Accuracy::k0_1ArcSec>();
+      test_planet
+          .operator()<VSOP87::Planet::kJupiter, VSOP87::Accuracy::k10ArcSec>();
+    }
+    expect_bool(SIMD::SetISA(SIMD::ISA::kMax), true);
+    static_assert(VSOP87::StaticSeries<VSOP87::Planet::kEarth,
+                                       VSOP87::Variable::kLongitude,
+                                       VSOP87::Accuracy::kFull>::kErrorBound ==
+                  0.0);
+    static_assert(VSOP87::StaticSeries<VSOP87::Planet::kJupiter,
+                                       VSOP87::Variable::kLongitude,
+                                       VSOP87::Accuracy::k10ArcSec>::kErrorBound <=
+                  10.0_arcsec);
+    static_assert([] {
+      double longitude{0.0};
+      VSOP87::Compute<VSOP87::Planet::kEarth, VSOP87::Accuracy::k10ArcSec>(
+          EpochJ2000, &longitude, nullptr, nullptr);
+      return longitude > 100.37_deg && longitude < 100.38_deg;
+    }());
+  }
+  std::cout << "OK!" << std::endl;
+
+  std::cout << "VSOP87: NUFFT Grid... ";
+  {
+    // 2 centuries every 0.5 days
+    constexpr double kTTBegin{EpochJ1900};
+    constexpr double kStepDays{0.5};
+    constexpr double kTauMax{1.0};
+    std::vector<double> longitudes(146100), latitudes(146100),
+        radius_vectors(146100);
+    for (VSOP87::Planet planet : {VSOP87::Planet::kMercury,
+                                  VSOP87::Planet::kEarth,
+                                  VSOP87::Planet::kNeptune}) {
+      VSOP87::ComputeGrid(kTTBegin, kStepDays, planet, longitudes, latitudes,
+                          radius_vectors);
+      std::vector<double>* outputs[]{&longitudes, &latitudes, &radius_vectors};
+      for (int v = 0; v < 3; v++) {
+        const PeriodicTermTable& table{
+            VSOP87::GetTable(planet, static_cast<VSOP87::Variable>(v))};
+        PeriodicTermNUFFT nufft{table};
+        for (std::size_t i = 0; i < outputs[v]->size(); i += 997) {
+          double tau{(kTTBegin + i * kStepDays - EpochJ2000) / 365250.0};
+          expect_double((*outputs[v])[i], PeriodicTermComputeScalar(table, tau),
+                        0.0, nufft.GetErrorBound(kTauMax));
+        }
+      }
+    }
+    // Coarser tolerance, and a grid shorter than a block
+    PeriodicTermNUFFT nufft{VSOP87::GetTable(VSOP87::Planet::kMars,
+                                             VSOP87::Variable::kLongitude),
+                            1.0e-8};
+    std::vector<double> values(100);
+    nufft.Compute(0.1, 1.0e-4, values);
+    for (std::size_t i = 0; i < values.size(); i++) {
+      expect_double(values[i],
+                    PeriodicTermComputeScalar(
+                        VSOP87::GetTable(VSOP87::Planet::kMars,
+                                         VSOP87::Variable::kLongitude),
+                        0.1 + i * 1.0e-4),
+                    0.0, nufft.GetErrorBound(kTauMax));
+    }
+  }
+  std::cout << "OK!" << std::endl;
+
+  std::cout << "VSOP87: Series File... ";
+  {
+    std::string filename{
+        (std::filesystem::temp_directory_path() / "pa_test_series.bin")
+            .string()};
+    double tts[]{EpochJ1900, Date{1992, 10, 13.0}.GetJulianDate(),
+                 EpochJ2000 + 36525.0 * 7.7};
+    expect_bool(VSOP87::SaveSeriesFile(filename), true);
+    PeriodicSeriesFile file;
+    expect_bool(PeriodicSeriesFile::Load(filename, &file), true);
+    expect_bool(file.GetSeriesCount() == 24, true);
+    for (int p = 0; p < static_cast<int>(VSOP87::Planet::kMax); p++) {
+      VSOP87::Planet planet{static_cast<VSOP87::Planet>(p)};
+      for (double tt : tts) {
+        double tau{(tt - EpochJ2000) / 365250.0};
+        double values[3];
+        expect_bool(VSOP87::Compute(file, tt, planet, &values[0], &values[1],
+                                    &values[2]),
+                    true);
+        for (int v = 0; v < 3; v++) {
+          auto variable{static_cast<VSOP87::Variable>(v)};
+          const PeriodicTermTable& table{VSOP87::GetTable(planet, variable)};
+          expect_double(values[v], PeriodicTermComputeScalar(table, tau), 0.0,
+                        2.0 * PeriodicTermComputeSIMDErrorBound(table, tau));
+          const PeriodicSeriesFile::Series* series{
+              file.Find(VSOP87::GetSeriesName(planet, variable))};
+          double value, rate, expected_value, expected_rate;
+          series->ComputeWithRate(tau, &value, &rate);
+          PeriodicTermComputeWithRateScalar(table, tau, &expected_value,
+                                            &expected_rate);
+          expect_double(value, values[v], 0.0, 1.0e-12);
+          expect_double(rate, expected_rate, 1.0e-10, 1.0e-9);
+        }
+      }
+    }
+
+    // Truncated
+    expect_bool(
+        VSOP87::SaveSeriesFile(filename, VSOP87::Accuracy::k1ArcSec), true);
+    expect_bool(PeriodicSeriesFile::Load(filename, &file), true);
+    for (double tt : tts) {
+      double tau{(tt - EpochJ2000) / 365250.0};
+      for (int v = 0; v < 3; v++) {
+        auto variable{static_cast<VSOP87::Variable>(v)};
+        const PeriodicSeriesFile::Series* series{file.Find(
+            VSOP87::GetSeriesName(VSOP87::Planet::kMars, variable))};
+        const PeriodicTermTable& table{
+            VSOP87::GetTable(VSOP87::Planet::kMars, variable)};
+        expect_bool(series->GetErrorBound() <= 1.0_arcsec, true);
+        expect_bool(series->GetTermCount(0) < table.degrees[0].size, true);
+        expect_double(series->Compute(tau),
+                      PeriodicTermComputeScalar(table, tau), 0.0,
+                      series->GetErrorBound() +
+                          2.0 * PeriodicTermComputeSIMDErrorBound(table, tau));
+      }
+    }
+    expect_bool(file.Find("VSOP87D/Pluto/L") == nullptr, true);
+
+    {
+      std::fstream file(filename, std::ios::in | std::ios::out |
+                                      std::ios::binary);
+      file.write("X", 1);
+    }
+    expect_bool(PeriodicSeriesFile::Load(filename, &file), false);
+    std::filesystem::remove(filename);
+  }
+  std::cout << "OK!" << std::endl;
+
+  std::cout << "VSOP87: Rates... ";
+  {
+    double tts[]{EpochJ1900, Date{1992, 10, 13.0}.GetJulianDate()};
+    for (int p = 0; p < static_cast<int>(VSOP87::Planet::kMax); p++) {
+      VSOP87::Planet planet{static_cast<VSOP87::Planet>(p)};
+      for (double tt : tts) {
+        double values[3], rates[3], before[3], after[3];
+        VSOP87::ComputeWithRates(tt, planet, &values[0], &values[1],
+                                 &values[2], &rates[0], &rates[1], &rates[2]);
+        VSOP87::Compute(tt, planet, &before[0], &before[1], &before[2]);
+        for (int v = 0; v < 3; v++) {
+          expect_double(values[v], before[v], 1.0e-14, 1.0e-12);
+        }
+        // Central difference, with an error of order h^2
+        constexpr double h{0.01};
+        VSOP87::Compute(tt - h, planet, &before[0], &before[1], &before[2]);
+        VSOP87::Compute(tt + h, planet, &after[0], &after[1], &after[2]);
+        for (int v = 0; v < 3; v++) {
+          expect_double(rates[v], (after[v] - before[v]) / (2.0 * h), 1.0e-6,
+                        1.0e-10);
+        }
+      }
+    }
+    static_assert([] {
+      double rate{0.0};
+      VSOP87::ComputeWithRates(EpochJ2000, VSOP87::Planet::kEarth, nullptr,
+                               nullptr, nullptr, &rate, nullptr, nullptr);
+      return rate > 1.0_deg && rate < 1.02_deg;
+    }());
+
+    // Aberration of the Sun from the rate of the Earth, against that from the
+    // daily variation series
+    for (double tt : tts) {
+      Observer observer{tt};
+      expect_double(observer.GetAberrationLongitude(Observer::Body::kSun),
+                    -0.005775518 * observer.GetRadiusVectorAU(Observer::Body::kSun) *
+                        Sun::GetDailyVariation(tt),
+                    0.0, 0.001_arcsec);
+    }
+  }
+  std::cout << "OK!" << std::endl;
+
+  std::cout << "VSOP87: Batch... ";
+  {
+    std::vector<double> tts;
+    for (int i = 0; i < 37; i++) tts.push_back(EpochJ1900 + 1234.5 * i);
+    std::vector<double> lons(tts.size()), lats(tts.size()), rs(tts.size());
+    for (int p = 0; p < static_cast<int>(VSOP87::Planet::kMax); p++) {
+      VSOP87::Planet planet{static_cast<VSOP87::Planet>(p)};
+      VSOP87::Compute(tts, planet, lons, lats, rs);
+      for (std::size_t i = 0; i < tts.size(); i++) {
+        double lon, lat, r;
+        VSOP87::Compute(tts[i], planet, &lon, &lat, &r);
+        expect_double(lons[i], lon, 1.0e-14, 1.0e-12);
+        expect_double(lats[i], lat, 0.0, 1.0e-12);
+        expect_double(rs[i], r, 0.0, 1.0e-12);
+      }
+    }
+  }
+  std::cout << "OK!" << std::endl;
+
+  std::cout << "VSOP87: Rectangular... ";
+  {
+    std::vector<double> tts;
+    for (int i = 0; i < 11; i++) tts.push_back(EpochJ1900 + 4321.5 * i);
+    std::vector<double> xs(tts.size()), ys(tts.size()), zs(tts.size());
+    for (int p = 0; p < static_cast<int>(VSOP87::Planet::kMax); p++) {
+      VSOP87::Planet planet{static_cast<VSOP87::Planet>(p)};
+      VSOP87::ComputeRectangular(tts, planet, xs, ys, zs);
+      for (std::size_t i = 0; i < tts.size(); i++) {
+        double x, y, z, lon, lat, r;
+        VSOP87::ComputeRectangular(tts[i], planet, &x, &y, &z);
+        expect_double(xs[i], x, 0.0, 1.0e-10);
+        expect_double(ys[i], y, 0.0, 1.0e-10);
+        expect_double(zs[i], z, 0.0, 1.0e-10);
+        VSOP87::Compute(tts[i], planet, &lon, &lat, &r);
+        expect_double(x, r * std::cos(lat) * std::cos(lon), 0.0, 1.0e-12);
+        expect_double(y, r * std::cos(lat) * std::sin(lon), 0.0, 1.0e-12);
+        expect_double(z, r * std::sin(lat), 0.0, 1.0e-12);
+      }
+    }
+  }
+  std::cout << "OK!" << std::endl;
+
+  std::cout << "VSOP87: Stepper... ";
+  {
+    // One-minute steps, across several reseeds
+    double tt_begin{Date{1992, 10, 13.0}.GetJulianDate()};
+    double step_days{1.0 / 1440.0};
+    VSOP87::Stepper stepper{tt_begin, step_days, VSOP87::Planet::kEarth, 256};
+    Sun::DailyVariationStepper sun_stepper{tt_begin, step_days, 256};
+    for (int n = 0; n <= 1000; n++) {
+      if (n % 50 == 0) {
+        double tt{tt_begin + n * step_days};
+        expect_double(stepper.GetTT(), tt, 0.0, 0.0);
+        double tau{(tt - EpochJ2000) / 365250.0};
+        double values[3];
+        stepper.Compute(&values[0], &values[1], &values[2]);
+        for (int v = 0; v < static_cast<int>(VSOP87::Variable::kMax); v++) {
+          expect_double(values[v],
+                        PeriodicTermComputeScalar(
+                            VSOP87::GetTable(VSOP87::Planet::kEarth,
+                                             static_cast<VSOP87::Variable>(v)),
+                            tau),
+                        1.0e-12, 1.0e-12);
+        }
+        expect_double(sun_stepper.Compute(), Sun::GetDailyVariation(tt), 1.0e-12,
+                      1.0e-15);
+      }
+      stepper.Step();
+      sun_stepper.Step();
+    }
+  }
+  std::cout << "OK!" << std::endl;
+}
+
+static void test_vsop87_accuracy() {
+  std::cout << "VSOP87: Accuracy... ";
+  {
+    VSOP87::Accuracy accuracies[]{VSOP87::Accuracy::k0_1ArcSec,
+                                  VSOP87::Accuracy::k1ArcSec,
+                                  VSOP87::Accuracy::k10ArcSec};
+    double tts[]{EpochJ1900, Date{1992, 10, 13.0}.GetJulianDate(),
+                 EpochJ2000 + 36525.0 * 7.7};
+    for (int p = 0; p < static_cast<int>(VSOP87::Planet::kMax); p++) {
+      VSOP87::Planet planet{static_cast<VSOP87::Planet>(p)};
+      for (auto accuracy : accuracies) {
+        for (double tt : tts) {
+          double full[3], truncated[3], mixed[3];
+          VSOP87::Compute(tt, planet, &full[0], &full[1], &full[2]);
+          VSOP87::Compute(tt, planet, &truncated[0], &truncated[1],
+                          &truncated[2], accuracy);
+          VSOP87::Compute(tt, planet, &mixed[0], &mixed[1], &mixed[2],
+                          accuracy, VSOP87::Precision::kMixed);
+          for (int v = 0; v < 3; v++) {
+            VSOP87::Variable variable{static_cast<VSOP87::Variable>(v)};
+            const PeriodicSeries::Truncation& truncation{
+                VSOP87::GetTruncation(planet, variable, accuracy)};
+            expect_double(truncated[v], full[v], 1.0e-14,
+                          truncation.error_bound);
+            const PeriodicSeries::MixedPrecision& mixed_precision{
+                VSOP87::GetMixedPrecision(planet, variable, accuracy)};
+            expect_bool(mixed_precision.error_bound <=
+                            VSOP87::GetTruncation(planet, variable, accuracy)
+                                    .error_bound +
+                                1.0e-6,
+                        true);
+            expect_double(mixed[v], full[v], 1.0e-14,
+                          mixed_precision.error_bound);
+          }
+        }
+      }
+    }
+
+    Observer observer{Date{1992, 10, 13.0}.GetJulianDate()};
+    double longitude{observer.GetApparentLongitude(Observer::Body::kSun)};
+    observer.SetVSOP87Accuracy(VSOP87::Accuracy::k1ArcSec);
+    expect_double(observer.GetApparentLongitude(Observer::Body::kSun),
+                  longitude, 0.0, 1.0_arcsec);
+  }
+  std::cout << "OK!" << std::endl;
+}
+
+static void test_chebyshev_ephemeris() {
+  std::cout << "Chebyshev Ephemeris... ";
+  {
+    double tt_begin{Date{2020, 1, 1.0}.GetJulianDate()};
+    ChebyshevEphemeris ephemeris{
+        ChebyshevEphemeris::Build(tt_begin, tt_begin + 64.0, 1.0e-10)};
+    for (int b = 0; b < static_cast<int>(ChebyshevEphemeris::Body::kMax);
+         b++) {
+      const ChebyshevEphemeris::Segments& segments{
+          ephemeris.GetSegments(static_cast<ChebyshevEphemeris::Body>(b))};
+      expect_bool(segments.max_error <= 1.0e-10, true);
+    }
+    double lon;
+    expect_bool(ephemeris.Compute(ChebyshevEphemeris::Body::kMoon,
+                                  tt_begin - 1.0, &lon, nullptr, nullptr),
+                false);
+
+    std::string filename{
+        (std::filesystem::temp_directory_path() / "pa_test_ephemeris.bin")
+            .string()};
+    expect_bool(ephemeris.Save(filename), true);
+    ChebyshevEphemeris loaded;
+    expect_bool(ChebyshevEphemeris::Load(filename, &loaded), true);
+    for (double tt = tt_begin; tt <= tt_begin + 64.0; tt += 0.9) {
+      for (int b = 0; b < static_cast<int>(ChebyshevEphemeris::Body::kMax);
+           b++) {
+        double v1[3], v2[3];
+        auto body{static_cast<ChebyshevEphemeris::Body>(b)};
+        expect_bool(ephemeris.Compute(body, tt, &v1[0], &v1[1], &v1[2]), true);
+        expect_bool(loaded.Compute(body, tt, &v2[0], &v2[1], &v2[2]), true);
+        for (int i = 0; i < 3; i++) expect_bool(v1[i] == v2[i], true);
+      }
+    }
+    {
+      std::fstream file(filename, std::ios::in | std::ios::out |
+                                      std::ios::binary);
+      file.write("X", 1);
+    }
+    expect_bool(ChebyshevEphemeris::Load(filename, &loaded), false);
+    // Directory entry of the first body (after the 24-byte header): Segment
+    // count, coefficient count, then segment days
+    auto corrupt{[&](std::streamoff offset, const auto& value) {
+      expect_bool(ephemeris.Save(filename), true);
+      std::fstream file(filename, std::ios::in | std::ios::out |
+                                      std::ios::binary);
+      file.seekp(24 + offset);
+      file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }};
+    corrupt(4, int32_t{0});
+    expect_bool(ChebyshevEphemeris::Load(filename, &loaded), false);
+    corrupt(8, int32_t{0});
+    expect_bool(ChebyshevEphemeris::Load(filename, &loaded), false);
+    corrupt(8, int32_t{ChebyshevEphemeris::kMaxCoefficientCount + 1});
+    expect_bool(ChebyshevEphemeris::Load(filename, &loaded), false);
+    corrupt(24, 0.0);
+    expect_bool(ChebyshevEphemeris::Load(filename, &loaded), false);
+    corrupt(24, std::nan(""));
+    expect_bool(ChebyshevEphemeris::Load(filename, &loaded), false);
+    std::filesystem::remove(filename);
+
+    for (double tt = tt_begin; tt <= tt_begin + 64.0; tt += 3.7) {
+      Observer observer{tt};
+      double sun_lon{observer.GetApparentLongitude(Observer::Body::kSun)};
+      double sun_lat{observer.GetApparentLatitude(Observer::Body::kSun)};
+      double moon_lon{observer.GetApparentLongitude(Observer::Body::kMoon)};
+      double moon_lat{observer.GetApparentLatitude(Observer::Body::kMoon)};
+      observer.SetEphemeris(&ephemeris);
+      expect_double(observer.GetApparentLongitude(Observer::Body::kSun),
+                    sun_lon, 0.0, 0.0001_arcsec);
+      expect_double(observer.GetApparentLatitude(Observer::Body::kSun),
+                    sun_lat, 0.0, 0.0001_arcsec);
+      expect_double(observer.GetApparentLongitude(Observer::Body::kMoon),
+                    moon_lon, 0.0, 0.0001_arcsec);
+      expect_double(observer.GetApparentLatitude(Observer::Body::kMoon),
+                    moon_lat, 0.0, 0.0001_arcsec);
+    }
+  }
+  std::cout << "OK!" << std::endl;
+}
+
+static void test_thread_pool() {
+  std::cout << "Thread Pool... ";
+  {
+    ThreadPool pool{ThreadPool::Options{4, false}};
+    expect_bool(pool.GetThreadCount() == 4, true);
+    // Each item exactly once, with uneven costs, and nested
+    std::vector<std::atomic<int>> counts(1000);
+    pool.ParallelFor(
+        counts.size(),
+        [&](std::size_t begin, std::size_t end) {
+          for (std::size_t i = begin; i < end; i++) counts[i]++;
+          pool.ParallelFor(2, [&](std::size_t, std::size_t) {});
+        },
+        [](std::size_t i) { return i < 10 ? 1000.0 : 1.0; });
+    for (auto& count : counts) expect_bool(count == 1, true);
+    bool thrown{false};
+    try {
+      pool.ParallelFor(100, [](std::size_t begin, std::size_t) {
+        if (begin == 0) throw std::runtime_error("test");
+      });
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    expect_bool(thrown, true);
+    // The caller sleeps, rather than spins, while the other threads finish
+    auto caller_id{std::this_thread::get_id()};
+    auto cpu_time = [] {
+      timespec ts;
+      clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+      return ts.tv_sec + 1e-9 * ts.tv_nsec;
+    };
+    double cpu_begin{cpu_time()};
+    pool.ParallelFor(4, [&](std::size_t, std::size_t) {
+      bool caller{std::this_thread::get_id() == caller_id};
+      std::this_thread::sleep_for(std::chrono::milliseconds(caller ? 20 : 200));
+    });
+    expect_bool(cpu_time() - cpu_begin < 0.05, true);
+
+    // Same values as the single-threaded functions
+    std::vector<double> tts;
+    for (int i = 0; i < 1000; i++) tts.push_back(EpochJ1900 + i * 36.6);
+    std::size_t size{tts.size()};
+    VSOP87::Planet planets[]{VSOP87::Planet::kMercury, VSOP87::Planet::kJupiter};
+    std::vector<double> lons(2 * size), lats(2 * size), rs(2 * size);
+    VSOP87::Compute(pool, tts, planets, lons, lats, rs,
+                    VSOP87::Accuracy::k1ArcSec);
+    for (int k = 0; k < 2; k++) {
+      std::vector<double> lons1(size), lats1(size), rs1(size);
+      VSOP87::Compute(tts, planets[k], lons1, lats1, rs1,
+                      VSOP87::Accuracy::k1ArcSec);
+      for (std::size_t i = 0; i < size; i++) {
+        expect_bool(lons[k * size + i] == lons1[i] &&
+                        lats[k * size + i] == lats1[i] &&
+                        rs[k * size + i] == rs1[i],
+                    true);
+      }
+    }
+    ELP82JM::Compute(pool, tts, std::span<double>{lons}.first(size), {},
+                     std::span<double>{rs}.first(size));
+    std::vector<double> lons1(size), rs1(size);
+    ELP82JM::Compute(tts, lons1, {}, rs1);
+    for (std::size_t i = 0; i < size; i++) {
+      expect_bool(lons[i] == lons1[i] && rs[i] == rs1[i], true);
+    }
+    Observer observer{EpochJ2000};
+    observer.SetNutationAlgorithm(Observer::NutationAlgorithm::kIAU1980);
+    Observer::Body bodies[]{Observer::Body::kSun, Observer::Body::kMoon};
+    observer.ComputeApparentPositions(pool, tts, bodies, lons, lats);
+    observer.ComputeNutation(pool, tts, std::span<double>{rs}.first(size), {});
+    std::vector<double> nutations(size);
+    EarthNutation::ComputeNutationIAU1980(tts, nutations, {});
+    for (std::size_t i = 0; i < size; i++) {
+      Observer o{tts[i]};
+      o.SetNutationAlgorithm(Observer::NutationAlgorithm::kIAU1980);
+      expect_bool(rs[i] == nutations[i], true);
+      for (int k = 0; k < 2; k++) {
+        expect_bool(lons[k * size + i] == o.GetApparentLongitude(bodies[k]) &&
+                        lats[k * size + i] == o.GetApparentLatitude(bodies[k]),
+                    true);
+      }
+    }
+  }
+  std::cout << "OK!" << std::endl;
 }
 
 static void test_solver() {
@@ -305,5 +1256,10 @@ void test_internal() {
   test_nutation_obliquity();
   test_sun();
   test_moon();
+  test_simd();
+  test_vsop87();
+  test_vsop87_accuracy();
+  test_chebyshev_ephemeris();
+  test_thread_pool();
   test_solver();
 }
@@ -0,0 +1,194 @@
+#include "thread_pool.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <exception>
+
+using namespace PA;
+
+namespace {
+
+// Pool and queue of the current thread, if it is a worker
+thread_local const ThreadPool *tls_pool{nullptr};
+thread_local int tls_queue_index{0};
+
+int GetHardwareThreadCount() {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+}  // namespace
+
+struct ThreadPool::Job {
+  const std::function<void(std::size_t, std::size_t)> *body;
+  std::atomic<std::size_t> remaining;
+  std::mutex error_mutex;
+  std::exception_ptr error;
+};
+
+ThreadPool::ThreadPool() : ThreadPool(Options{0, false}) {}
+
+ThreadPool::ThreadPool(const Options &options)
+    : thread_count_(options.thread_count > 0 ? options.thread_count
+                                             : GetHardwareThreadCount()) {
+  for (int i = 0; i < thread_count_; i++) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  for (int i = 1; i < thread_count_; i++) {
+    threads_.emplace_back([this, i] { WorkerLoop(i); });
+    if (options.pin_threads) {
+      cpu_set_t cpus;
+      CPU_ZERO(&cpus);
+      CPU_SET(i % std::min(GetHardwareThreadCount(), CPU_SETSIZE), &cpus);
+      pthread_setaffinity_np(threads_.back().native_handle(), sizeof(cpus),
+                             &cpus);
+    }
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (auto &thread : threads_) thread.join();
+}
+
+ThreadPool &ThreadPool::GetDefault() {
+  static ThreadPool pool;
+  return pool;
+}
+
+int ThreadPool::GetQueueIndex() const noexcept {
+  return tls_pool == this ? tls_queue_index : 0;
+}
+
+void ThreadPool::Run(const Task &task) noexcept {
+  Job &job{*task.job};
+  try {
+    (*job.body)(task.begin, task.end);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(job.error_mutex);
+    if (!job.error) job.error = std::current_exception();
+  }
+  // The job may be gone as soon as remaining drops to 0, so that only the pool
+  // is used to wake its caller
+  if (job.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    {
+      // Orders the wake-up after the predicate of the caller about to wait
+      std::lock_guard<std::mutex> lock(mutex_);
+    }
+    wake_.notify_all();
+  }
+}
+
+bool ThreadPool::RunTask(int index) {
+  for (int k = 0; k < thread_count_; k++) {
+    Queue &queue{*queues_[(index + k) % thread_count_]};
+    Task task;
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (queue.tasks.empty()) continue;
+      // Own queue from the back (the chunks dealt last, still warm), others
+      // from the front
+      if (k == 0) {
+        task = queue.tasks.back();
+        queue.tasks.pop_back();
+      } else {
+        task = queue.tasks.front();
+        queue.tasks.pop_front();
+      }
+    }
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    Run(task);
+    return true;
+  }
+  return false;
+}
+
+void ThreadPool::WorkerLoop(int index) {
+  tls_pool = this;
+  tls_queue_index = index;
+  while (true) {
+    if (RunTask(index)) continue;
+    std::unique_lock<std::mutex> lock(mutex_);
+    wake_.wait(lock, [this] {
+      return stopping_ || queued_.load(std::memory_order_relaxed) > 0;
+    });
+    if (stopping_) return;
+  }
+}
+
+void ThreadPool::ParallelFor(
+    std::size_t count,
+    const std::function<void(std::size_t, std::size_t)> &body,
+    const std::function<double(std::size_t)> &cost) {
+  if (count == 0) return;
+  std::size_t chunk_count{std::min<std::size_t>(
+      count, static_cast<std::size_t>(thread_count_) * kChunksPerThread)};
+  if (chunk_count <= 1) {
+    body(0, count);
+    return;
+  }
+
+  // Chunk boundaries, cutting the cumulative cost at multiples of
+  // total / chunk_count
+  std::vector<std::size_t> ends;
+  std::vector<double> cumulative;
+  double total{0.0};
+  if (cost) {
+    cumulative.resize(count);
+    for (std::size_t i = 0; i < count; i++) {
+      total += std::max(cost(i), 0.0);
+      cumulative[i] = total;
+    }
+  }
+  if (total > 0.0) {
+    for (std::size_t i = 0; i < count; i++) {
+      double target{total * (ends.size() + 1) / chunk_count};
+      if (cumulative[i] >= target || i + 1 == count) ends.push_back(i + 1);
+    }
+  } else {
+    for (std::size_t c = 1; c <= chunk_count; c++) {
+      ends.push_back(count * c / chunk_count);
+    }
+  }
+
+  Job job;
+  job.body = &body;
+  job.remaining.store(ends.size(), std::memory_order_relaxed);
+  int self{GetQueueIndex()};
+  std::size_t begin{0};
+  for (std::size_t c = 0; c < ends.size(); c++) {
+    // Dealt round-robin from the next thread, the calling thread getting the
+    // last chunks
+    Queue &queue{*queues_[(self + 1 + c) % thread_count_]};
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.tasks.push_back(Task{&job, begin, ends[c]});
+    }
+    begin = ends[c];
+  }
+  queued_.fetch_add(static_cast<int64_t>(ends.size()),
+                    std::memory_order_relaxed);
+  {
+    // Orders the wake-up after the predicate of a worker about to wait
+    std::lock_guard<std::mutex> lock(mutex_);
+  }
+  wake_.notify_all();
+
+  // Runs chunks while there are some to take, then sleeps until the last ones
+  // are done by the other threads, or more are queued (e.g. by the nested
+  // calls of those)
+  while (job.remaining.load(std::memory_order_acquire) > 0) {
+    if (RunTask(self)) continue;
+    std::unique_lock<std::mutex> lock(mutex_);
+    wake_.wait(lock, [this, &job] {
+      return job.remaining.load(std::memory_order_acquire) == 0 ||
+             queued_.load(std::memory_order_relaxed) > 0;
+    });
+  }
+  if (job.error) std::rethrow_exception(job.error);
+}
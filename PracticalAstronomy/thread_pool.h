@@ -0,0 +1,95 @@
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace PA {
+
+// Work-stealing pool of threads for the batch computations (VSOP87, ELP82JM,
+// Observer, ChebyshevEphemeris::Build)
+// - ParallelFor() splits an index range into kChunksPerThread chunks per
+//   thread of about equal estimated cost, so that uneven items (e.g. the
+//   series of Mercury and of Jupiter) spread evenly; the chunks are dealt to
+//   the queues of all threads
+// - Each thread takes the chunks of its own queue from the back, then steals
+//   those of the others from the front, so that the threads finishing early
+//   take over the work of the late ones
+// - The calling thread runs chunks too; a chunk may itself call ParallelFor()
+//   on the same pool
+class ThreadPool {
+ public:
+  struct Options {
+    // Threads running the work, the calling thread included (0: one per
+    // hardware thread)
+    int thread_count;
+    // Pins the worker thread k (k >= 1) to the CPU k modulo the hardware
+    // threads (Linux), e.g. to keep each thread on its core and its caches
+    bool pin_threads;
+  };
+
+  static constexpr int kChunksPerThread{4};
+
+  ThreadPool();
+  explicit ThreadPool(const Options &options);
+  ~ThreadPool();
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  int GetThreadCount() const noexcept { return thread_count_; }
+
+  // Runs body(begin, end) over chunks covering [0, count), returning when all
+  // are done
+  // - cost(i): Estimated cost of the item i, e.g. its number of terms
+  //   (uniform if empty)
+  // - Rethrows the first exception thrown by body, once the other chunks are
+  //   done
+  void ParallelFor(std::size_t count,
+                   const std::function<void(std::size_t, std::size_t)> &body,
+                   const std::function<double(std::size_t)> &cost = {});
+
+  // Pool shared by the process: One thread per hardware thread, started on
+  // first use
+  static ThreadPool &GetDefault();
+
+ private:
+  struct Job;
+  struct Task {
+    Job *job;
+    std::size_t begin;
+    std::size_t end;
+  };
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  // Runs a task of the queue index, else one stolen from another queue;
+  // false if all are empty
+  bool RunTask(int index);
+  void Run(const Task &task) noexcept;
+  void WorkerLoop(int index);
+  // Queue of the calling thread: Its own for a worker of this pool, else 0
+  int GetQueueIndex() const noexcept;
+
+  int thread_count_;
+  // One per thread, queue 0 for the threads outside the pool
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> threads_;
+  std::atomic<int64_t> queued_{0};
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  bool stopping_{false};
+};
+
+}  // namespace PA
+
+#endif  // THREAD_POOL_H_
@@ -1,6 +1,12 @@
 #ifndef UTILS_H_
 #define UTILS_H_
 
+#include <cmath>
+#include <type_traits>
+
+#include "simd.h"
+#include "simd_dispatch.h"
+
 template <class T, int SZ>
 constexpr auto horner_polynomial(const T (&coeffs)[SZ], T x) noexcept {
   T value{0};
@@ -8,6 +14,29 @@ constexpr auto horner_polynomial(const T (&coeffs)[SZ], T x) noexcept {
   return value;
 }
 
+// sin(k x) and cos(k x) at index k + kMax, for |k| <= count (<= kMax), from a
+// single sin/cos by the Chebyshev recurrence
+//   sin((k + 1) x) = 2 cos(x) sin(k x) - sin((k - 1) x)
+//   cos((k + 1) x) = 2 cos(x) cos(k x) - cos((k - 1) x)
+template <int kMax>
+constexpr void sin_cos_multiples(double x, double *sin_kx, double *cos_kx,
+                                 int count = kMax) noexcept {
+  double *s{sin_kx + kMax};
+  double *c{cos_kx + kMax};
+  s[0] = 0.0;
+  c[0] = 1.0;
+  if (count == 0) return;
+  PA::SIMD::SinCos(x, &s[1], &c[1]);
+  for (int k = 1; k < count; k++) {
+    s[k + 1] = 2.0 * c[1] * s[k] - s[k - 1];
+    c[k + 1] = 2.0 * c[1] * c[k] - c[k - 1];
+  }
+  for (int k = 1; k <= count; k++) {
+    s[-k] = -s[k];
+    c[-k] = c[k];
+  }
+}
+
 struct PeriodicTerm {
   double a;
   double b;
@@ -28,8 +57,36 @@ struct PeriodicTermTable {
   } method;
 };
 
-constexpr double PeriodicTermCompute(const PeriodicTermTable &table,
-                                     double t) noexcept {
+// Periodic terms of several tables sharing one table of their distinct
+// frequencies (see Utilities/main.cpp): Each a sin(b + c t) or a cos(b + c t)
+// is written p cos(c t) + q sin(c t), so that the sin/cos of c t are computed
+// once per frequency; terms of a degree with the same frequency are summed
+struct FrequencyTerm {
+  int frequency;  // Index of c in SharedFrequencyTable::frequencies
+  double p;
+  double q;
+};
+
+struct FrequencyTermTableDegree {
+  const struct FrequencyTerm *terms;
+  int size;
+};
+
+struct FrequencyTermTable {
+  const struct FrequencyTermTableDegree *degrees;
+  int size;
+};
+
+struct SharedFrequencyTable {
+  const double *frequencies;
+  int frequency_count;
+  const struct FrequencyTermTable *tables;
+  int table_count;
+};
+
+// Reference evaluation, with the sin/cos of libm
+constexpr double PeriodicTermComputeScalar(const PeriodicTermTable &table,
+                                           double t) noexcept {
   double value{0.0};
   switch (table.method) {
     case PeriodicTermTable::Method::kSin: {
@@ -64,4 +121,154 @@ constexpr double PeriodicTermCompute(const PeriodicTermTable &table,
   return value;
 }
 
+// Value and derivative w.r.t. t, both from the same sin/cos of each term:
+// d/dt [t^d a sin(b + c t)] = d t^(d-1) a sin(b + c t) + t^d a c cos(b + c t)
+// d/dt [t^d a cos(b + c t)] = d t^(d-1) a cos(b + c t) - t^d a c sin(b + c t)
+constexpr void PeriodicTermComputeWithRateScalar(const PeriodicTermTable &table,
+                                                 double t, double *p_value,
+                                                 double *p_rate) noexcept {
+  double value{0.0};
+  double rate{0.0};
+  for (int degree = table.size - 1; degree >= 0; degree--) {
+    double sum{0.0};
+    double rate_sum{0.0};
+    for (int i = 0; i < table.degrees[degree].size; i++) {
+      const PeriodicTerm &pt{table.degrees[degree].terms[i]};
+      double s{std::sin(pt.b + pt.c * t)};
+      double c{std::cos(pt.b + pt.c * t)};
+      if (table.method == PeriodicTermTable::Method::kSin) {
+        sum += pt.a * s;
+        rate_sum += pt.a * pt.c * c;
+      } else {
+        sum += pt.a * c;
+        rate_sum -= pt.a * pt.c * s;
+      }
+    }
+    // Horner scheme for the derivative of value = value * t + sum
+    rate = rate * t + rate_sum + value;
+    value = value * t + sum;
+  }
+  if (p_value) *p_value = value;
+  if (p_rate) *p_rate = rate;
+}
+
+namespace PA {
+namespace SIMD {
+inline namespace PA_SIMD_ISA {
+
+// sin_cos_multiples(), an x per lane
+template <int kMax>
+inline void SinCosMultiples(VecD x, VecD *sin_kx, VecD *cos_kx,
+                            int count = kMax) noexcept {
+  VecD *s{sin_kx + kMax};
+  VecD *c{cos_kx + kMax};
+  s[0] = VecD{};
+  c[0] = Broadcast(1.0);
+  if (count == 0) return;
+  SinCos(x, &s[1], &c[1]);
+  for (int k = 1; k < count; k++) {
+    s[k + 1] = 2.0 * c[1] * s[k] - s[k - 1];
+    c[k + 1] = 2.0 * c[1] * c[k] - c[k - 1];
+  }
+  for (int k = 1; k <= count; k++) {
+    s[-k] = -s[k];
+    c[-k] = c[k];
+  }
+}
+
+template <PeriodicTermTable::Method kMethod>
+inline double ComputePeriodicTermDegree(const PeriodicTermTableDegree &degree,
+                                        double t) noexcept {
+  VecD sum{};
+  int i{0};
+  for (; i + kWidth <= degree.size; i += kWidth) {
+    VecD a, b, c;
+    for (int l = 0; l < kWidth; l++) {
+      a[l] = degree.terms[i + l].a;
+      b[l] = degree.terms[i + l].b;
+      c[l] = degree.terms[i + l].c;
+    }
+    if constexpr (kMethod == PeriodicTermTable::Method::kSin) {
+      sum += a * Sin(b + c * t);
+    } else {
+      sum += a * Cos(b + c * t);
+    }
+  }
+  double value{ReduceAdd(sum)};
+  for (; i < degree.size; i++) {
+    const PeriodicTerm &pt{degree.terms[i]};
+    if constexpr (kMethod == PeriodicTermTable::Method::kSin) {
+      value += pt.a * Sin(pt.b + pt.c * t);
+    } else {
+      value += pt.a * Cos(pt.b + pt.c * t);
+    }
+  }
+  return value;
+}
+
+inline double ComputePeriodicTerms(const PeriodicTermTable &table,
+                                   double t) noexcept {
+  double value{0.0};
+  for (int degree = table.size - 1; degree >= 0; degree--) {
+    double degree_value{
+        table.method == PeriodicTermTable::Method::kSin
+            ? ComputePeriodicTermDegree<PeriodicTermTable::Method::kSin>(
+                  table.degrees[degree], t)
+            : ComputePeriodicTermDegree<PeriodicTermTable::Method::kCos>(
+                  table.degrees[degree], t)};
+    value = value * t + degree_value;
+  }
+  return value;
+}
+
+}  // namespace PA_SIMD_ISA
+}  // namespace SIMD
+}  // namespace PA
+
+// Vectorized evaluation, lanes running over the terms of each degree, with the
+// vectors of the ISA of the translation unit
+// - Accuracy: |PeriodicTermComputeSIMD - PeriodicTermComputeScalar| is bounded
+//   by PeriodicTermComputeSIMDErrorBound(): 2 ulp(1) for each sin/cos (see
+//   simd.h) plus 1 ulp(1) per addition for the reordered summation, both
+//   scaled by sum(|a * t^degree|), and 1 ulp(|b| + |c * t|) of each argument,
+//   which rounds differently when contracted into an FMA (e.g. kernels built
+//   for AVX2, see simd_dispatch.h)
+inline double PeriodicTermComputeSIMD(const PeriodicTermTable &table,
+                                      double t) noexcept {
+  return PA::SIMD::ComputePeriodicTerms(table, t);
+}
+
+inline double PeriodicTermComputeSIMDErrorBound(const PeriodicTermTable &table,
+                                                double t) noexcept {
+  constexpr double kUlp1{0x1.0p-52};
+  double bound{0.0};
+  double t_power{1.0};
+  for (int degree = 0; degree < table.size; degree++) {
+    double magnitude{0.0};
+    double argument_error{0.0};
+    for (int i = 0; i < table.degrees[degree].size; i++) {
+      const PeriodicTerm &pt{table.degrees[degree].terms[i]};
+      magnitude += std::fabs(pt.a);
+      argument_error +=
+          std::fabs(pt.a) * (std::fabs(pt.b) + std::fabs(pt.c * t)) * kUlp1;
+    }
+    bound += ((2.0 + table.degrees[degree].size + table.size) * kUlp1 *
+                  magnitude +
+              argument_error) *
+             t_power;
+    t_power *= std::fabs(t);
+  }
+  return bound;
+}
+
+// Uses the vectorized kernel of the host ISA at run time (see
+// simd_dispatch.h), and the scalar loop when evaluated as a constant expression
+constexpr double PeriodicTermCompute(const PeriodicTermTable &table,
+                                     double t) noexcept {
+  if (std::is_constant_evaluated()) {
+    return PeriodicTermComputeScalar(table, t);
+  }
+  return PA::SIMD::GetKernels().periodic_terms(table, t);
+}
+
 #endif  // UTILS_H_
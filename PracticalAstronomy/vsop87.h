@@ -1,9 +1,24 @@
 #ifndef VSOP87_H_
 #define VSOP87_H_
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
 
+#include "date.h"
+#include "merged_periodic_series.h"
+#include "periodic_series.h"
+#include "periodic_series_file.h"
+#include "periodic_term_nufft.h"
+#include "periodic_term_stepper.h"
 #include "radian.h"
+#include "shared_frequency_series.h"
+#include "static_periodic_series.h"
+#include "thread_pool.h"
 #include "utils.h"
 
 namespace PA {
@@ -22,16 +37,163 @@ class VSOP87 {
     kMax,
   };
 
+  enum class Variable {
+    kLongitude,
+    kLatitude,
+    kRadiusVector,
+    kMax,
+  };
+
+  // Accuracy targets: Worst-case truncation error of each of the longitude,
+  // latitude (radians) and radius vector (AU) for |tt - J2000| <= 1000 years
+  enum class Accuracy {
+    kFull,
+    k0_1ArcSec,
+    k1ArcSec,
+    k10ArcSec,
+    kMax,
+  };
+
+  // Mixed precision: For the accuracy targets other than kFull, the smallest
+  // terms are evaluated in single precision, the target still bounding the
+  // total error (see PeriodicSeries::MixedPrecision)
+  enum class Precision {
+    kDouble,
+    kMixed,
+  };
+
   static constexpr void Compute(double tt, Planet planet, double *p_longitude, double *p_latitude,
-                                double *radius_vector_au) noexcept;
+                                double *radius_vector_au, Accuracy accuracy = Accuracy::kFull,
+                                Precision precision = Precision::kDouble) noexcept;
+  // Same, specialized at compile time for a planet and an accuracy target (see
+  // StaticSeries): the degree and term counts are constants and the truncation
+  // is resolved at compile time, summed by the kernels of the host ISA;
+  // outputs are skipped when null
+  // - kFull: Same as Compute(tt, kPlanet, ...), as the shared frequencies of
+  //   the full tables (see GetSharedFrequencySeries()) beat summing them term
+  //   by term
+  template <Planet kPlanet, Accuracy kAccuracy = Accuracy::kFull>
+  static constexpr void Compute(double tt, double *p_longitude, double *p_latitude,
+                                double *p_radius_vector_au) noexcept;
+  static inline void Compute(std::span<const double> tts, Planet planet,
+                             std::span<double> longitudes, std::span<double> latitudes,
+                             std::span<double> radius_vectors_au,
+                             Accuracy accuracy = Accuracy::kFull);
+  // Same, on the threads of a pool (see ThreadPool), for several planets
+  // - Outputs of planets[k] at [k * tts.size(), (k + 1) * tts.size()) of each
+  //   output (skipped when empty)
+  // - Tiles of epochs of each series, weighted by the number of terms
+  //   evaluated, so that the threads spread over the planets by the size of
+  //   their tables rather than by their count
+  static inline void Compute(ThreadPool &pool, std::span<const double> tts,
+                             std::span<const Planet> planets, std::span<double> longitudes,
+                             std::span<double> latitudes, std::span<double> radius_vectors_au,
+                             Accuracy accuracy = Accuracy::kFull);
+  static inline void Compute(ThreadPool &pool, std::span<const double> tts, Planet planet,
+                             std::span<double> longitudes, std::span<double> latitudes,
+                             std::span<double> radius_vectors_au,
+                             Accuracy accuracy = Accuracy::kFull);
+  // Positions on the uniform grid tt_n = tt_begin + n * step_days, for dense
+  // grids (e.g. millions of epochs over centuries)
+  // - Evaluated with a non-uniform FFT per series (see PeriodicTermNUFFT), in
+  //   O(terms * W + epochs * log(N)) instead of O(terms * epochs), W the
+  //   spread width and N the block size of each series
+  // - Accuracy: PeriodicTermNUFFT::GetErrorBound() of each series, i.e. about
+  //   tolerance * sum(|a * tau^degree|)
+  // - Outputs are skipped when their span is empty; each holds the epochs
+  //   n < its size
+  static inline void ComputeGrid(double tt_begin, double step_days, Planet planet,
+                                 std::span<double> longitudes, std::span<double> latitudes,
+                                 std::span<double> radius_vectors_au,
+                                 double tolerance = PeriodicTermNUFFT::kDefaultTolerance);
+  // Series loaded at run time (see PeriodicSeriesFile), named by
+  // GetSeriesName(), e.g. "VSOP87D/Mars/L"
+  // - SaveSeriesFile(): The built-in tables of all planets, truncated to the
+  //   accuracy target
+  // - Compute(file, ...): Same outputs as Compute(), from the series of a file;
+  //   false if it lacks one of those of the planet
+  static inline std::string GetSeriesName(Planet planet, Variable variable);
+  static inline bool SaveSeriesFile(const std::string &filename,
+                                    Accuracy accuracy = Accuracy::kFull);
+  static inline bool Compute(const PeriodicSeriesFile &file, double tt, Planet planet,
+                             double *p_longitude, double *p_latitude,
+                             double *p_radius_vector_au);
+  // Positions and their rates (radians or AU per day), from the same sin/cos of
+  // each term
+  static constexpr void ComputeWithRates(double tt, Planet planet, double *p_longitude,
+                                         double *p_latitude, double *p_radius_vector_au,
+                                         double *p_longitude_rate, double *p_latitude_rate,
+                                         double *p_radius_vector_au_rate) noexcept;
+  // Heliocentric positions of a planet and of the Earth at the same epoch, in
+  // one pass over a merged table (every geocentric position needs both)
+  static inline void ComputeWithEarth(double tt, Planet planet, double *p_longitude,
+                                      double *p_latitude, double *p_radius_vector_au,
+                                      double *p_earth_longitude, double *p_earth_latitude,
+                                      double *p_earth_radius_vector_au) noexcept;
+  // Rectangular coordinates (AU), heliocentric in the ecliptic and equinox of
+  // the date (the frame of VSOP87C), from the spherical VSOP87D series
+  // - Batched: From the batched series (see Compute()), converted with the
+  //   vector sin/cos; outputs are skipped when their span is empty
+  static inline void ComputeRectangular(double tt, Planet planet, double *p_x, double *p_y,
+                                        double *p_z) noexcept;
+  static inline void ComputeRectangular(std::span<const double> tts, Planet planet,
+                                        std::span<double> xs, std::span<double> ys,
+                                        std::span<double> zs);
   static constexpr void VSOP87DFrameToFK5(double tt, double *p_longitude,
                                           double *p_latitude) noexcept;
+  static constexpr const PeriodicTermTable &GetTable(Planet planet,
+                                                     Variable variable) noexcept;
+  static inline const PeriodicSeries &GetSeries(Planet planet,
+                                                Variable variable) noexcept;
+  static inline const PeriodicSeries::Truncation &GetTruncation(Planet planet, Variable variable,
+                                                                Accuracy accuracy) noexcept;
+  static inline const PeriodicSeries::MixedPrecision &GetMixedPrecision(
+      Planet planet, Variable variable, Accuracy accuracy) noexcept;
+  // L, B and R of a planet (then those of the Earth, with_earth) merged into
+  // one table
+  static inline const MergedPeriodicSeries &GetMergedSeries(Planet planet,
+                                                            bool with_earth = false) noexcept;
+  // L, B and R of a planet sharing the sin/cos of their distinct frequencies
+  // (see SharedFrequencySeries); used by Compute() for kFull in double
+  // precision
+  static inline const SharedFrequencySeries &GetSharedFrequencySeries(Planet planet) noexcept;
+
+  // Positions on the uniform grid tt_n = tt_begin + n * step_days, n = 0, 1, ...
+  // - Each step advances the terms with the angle-addition formulas instead of
+  //   evaluating them afresh (see PeriodicTermStepper)
+  class Stepper {
+   public:
+    inline Stepper(double tt_begin, double step_days, Planet planet,
+                   int reseed_interval = PeriodicTermStepper::kDefaultReseedInterval);
+
+    double GetTT() const noexcept { return tt_begin_ + step_ * step_days_; }
+    inline void Compute(double *p_longitude, double *p_latitude,
+                        double *p_radius_vector_au) const noexcept;
+    inline void Step() noexcept;
+
+   private:
+    double tt_begin_;
+    double step_days_;
+    int64_t step_{0};
+    PeriodicTermStepper steppers_[static_cast<int>(Variable::kMax)];
+  };
 
  private:
   constexpr VSOP87() noexcept {}
 
 #include "vsop87_internal.dat"
 
+  // The VSOP87D tables of a planet with their shared frequencies (see
+  // SharedFrequencySeries), compiled once in vsop87_frequencies.cpp
+  static const SharedFrequencyTable &GetSharedFrequencyTable(Planet planet) noexcept;
+
+  static constexpr double kAccuracyTolerances[]{
+      [static_cast<int>(Accuracy::kFull)] = 0.0,
+      [static_cast<int>(Accuracy::k0_1ArcSec)] = 0.1_arcsec,
+      [static_cast<int>(Accuracy::k1ArcSec)] = 1.0_arcsec,
+      [static_cast<int>(Accuracy::k10ArcSec)] = 10.0_arcsec,
+  };
+
   static constexpr PeriodicTermTable periodic_term_l_tables[]{
       [static_cast<int>(Planet::kMercury)] = mercury_l_table,
       [static_cast<int>(Planet::kVenus)] = venus_l_table,
@@ -64,10 +226,38 @@ class VSOP87 {
       [static_cast<int>(Planet::kUranus)] = uranus_r_table,
       [static_cast<int>(Planet::kNeptune)] = neptune_r_table,
   };
+
+ public:
+  // A table as a StaticPeriodicSeries, truncated to the accuracy target (see
+  // Accuracy)
+  template <Planet kPlanet, Variable kVariable, Accuracy kAccuracy = Accuracy::kFull>
+  using StaticSeries = StaticPeriodicSeries<GetTable(kPlanet, kVariable),
+                                            kAccuracyTolerances[static_cast<int>(kAccuracy)]>;
 };
 
+template <VSOP87::Planet kPlanet, VSOP87::Accuracy kAccuracy>
+constexpr void VSOP87::Compute(double tt, double *p_longitude, double *p_latitude,
+                               double *p_radius_vector_au) noexcept {
+  if constexpr (kAccuracy == Accuracy::kFull) {
+    Compute(tt, kPlanet, p_longitude, p_latitude, p_radius_vector_au);
+  } else {
+    double tau{(tt - EpochJ2000) / 365250.0};
+    if (p_longitude) {
+      *p_longitude = StaticSeries<kPlanet, Variable::kLongitude, kAccuracy>::Compute(tau);
+    }
+    if (p_latitude) {
+      *p_latitude = StaticSeries<kPlanet, Variable::kLatitude, kAccuracy>::Compute(tau);
+    }
+    if (p_radius_vector_au) {
+      *p_radius_vector_au =
+          StaticSeries<kPlanet, Variable::kRadiusVector, kAccuracy>::Compute(tau);
+    }
+  }
+}
+
 constexpr void VSOP87::Compute(double tt, VSOP87::Planet planet, double *p_longitude,
-                               double *p_latitude, double *p_radius_vector_au) noexcept {
+                               double *p_latitude, double *p_radius_vector_au,
+                               VSOP87::Accuracy accuracy, VSOP87::Precision precision) noexcept {
   // References:
   // - [Jean99] p.217: Chapter 32 (Positions of Planets)
   // - [Jean99] Chapter 25 (Solar Coordinates)
@@ -80,15 +270,410 @@ constexpr void VSOP87::Compute(double tt, VSOP87::Planet planet, double *p_longi
   double latitude{0.0};
   double radius_vector_au{0.0};
 
-  longitude = PeriodicTermCompute(periodic_term_l_tables[static_cast<int>(planet)], tau);
-  latitude = PeriodicTermCompute(periodic_term_b_tables[static_cast<int>(planet)], tau);
-  radius_vector_au = PeriodicTermCompute(periodic_term_r_tables[static_cast<int>(planet)], tau);
+  if (std::is_constant_evaluated()) {
+    longitude = PeriodicTermComputeScalar(periodic_term_l_tables[static_cast<int>(planet)], tau);
+    latitude = PeriodicTermComputeScalar(periodic_term_b_tables[static_cast<int>(planet)], tau);
+    radius_vector_au =
+        PeriodicTermComputeScalar(periodic_term_r_tables[static_cast<int>(planet)], tau);
+  } else if (accuracy == Accuracy::kFull) {
+    double values[static_cast<int>(Variable::kMax)];
+    GetSharedFrequencySeries(planet).Compute(tau, values);
+    longitude = values[static_cast<int>(Variable::kLongitude)];
+    latitude = values[static_cast<int>(Variable::kLatitude)];
+    radius_vector_au = values[static_cast<int>(Variable::kRadiusVector)];
+  } else if (precision == Precision::kMixed) {
+    longitude = GetSeries(planet, Variable::kLongitude)
+                    .Compute(tau, GetMixedPrecision(planet, Variable::kLongitude, accuracy));
+    latitude = GetSeries(planet, Variable::kLatitude)
+                   .Compute(tau, GetMixedPrecision(planet, Variable::kLatitude, accuracy));
+    radius_vector_au =
+        GetSeries(planet, Variable::kRadiusVector)
+            .Compute(tau, GetMixedPrecision(planet, Variable::kRadiusVector, accuracy));
+  } else {
+    longitude = GetSeries(planet, Variable::kLongitude)
+                    .Compute(tau, GetTruncation(planet, Variable::kLongitude, accuracy));
+    latitude = GetSeries(planet, Variable::kLatitude)
+                   .Compute(tau, GetTruncation(planet, Variable::kLatitude, accuracy));
+    radius_vector_au =
+        GetSeries(planet, Variable::kRadiusVector)
+            .Compute(tau, GetTruncation(planet, Variable::kRadiusVector, accuracy));
+  }
 
   if (p_longitude) *p_longitude = longitude;
   if (p_latitude) *p_latitude = latitude;
   if (p_radius_vector_au) *p_radius_vector_au = radius_vector_au;
 }
 
+constexpr void VSOP87::ComputeWithRates(double tt, VSOP87::Planet planet, double *p_longitude,
+                                        double *p_latitude, double *p_radius_vector_au,
+                                        double *p_longitude_rate, double *p_latitude_rate,
+                                        double *p_radius_vector_au_rate) noexcept {
+  double tau{(tt - EpochJ2000) / 365250.0};
+  double values[static_cast<int>(Variable::kMax)]{};
+  double rates[static_cast<int>(Variable::kMax)]{};
+  if (std::is_constant_evaluated()) {
+    for (int v = 0; v < static_cast<int>(Variable::kMax); v++) {
+      PeriodicTermComputeWithRateScalar(GetTable(planet, static_cast<Variable>(v)), tau,
+                                        &values[v], &rates[v]);
+    }
+  } else {
+    GetMergedSeries(planet).Compute(tau, values, rates);
+  }
+
+  double *outputs[]{p_longitude, p_latitude, p_radius_vector_au};
+  double *rate_outputs[]{p_longitude_rate, p_latitude_rate, p_radius_vector_au_rate};
+  for (int v = 0; v < static_cast<int>(Variable::kMax); v++) {
+    if (outputs[v]) *outputs[v] = values[v];
+    // Per millennium to per day
+    if (rate_outputs[v]) *rate_outputs[v] = rates[v] / 365250.0;
+  }
+}
+
+constexpr const PeriodicTermTable &VSOP87::GetTable(
+    VSOP87::Planet planet, VSOP87::Variable variable) noexcept {
+  switch (variable) {
+    case Variable::kLatitude:
+      return periodic_term_b_tables[static_cast<int>(planet)];
+    case Variable::kRadiusVector:
+      return periodic_term_r_tables[static_cast<int>(planet)];
+    default:
+      return periodic_term_l_tables[static_cast<int>(planet)];
+  }
+}
+
+// Batch evaluation over the epochs tts
+// - Outputs are skipped when their span is empty, otherwise they must have the
+//   size of tts
+// - Each term is applied to a tile of epochs at once (see PeriodicSeries), so
+//   the tables stream through the cache once per tile instead of once per
+//   epoch
+inline void VSOP87::Compute(std::span<const double> tts, VSOP87::Planet planet,
+                            std::span<double> longitudes, std::span<double> latitudes,
+                            std::span<double> radius_vectors_au,
+                            VSOP87::Accuracy accuracy) {
+  std::vector<double> taus(tts.size());
+  for (std::size_t i = 0; i < tts.size(); i++) {
+    taus[i] = (tts[i] - EpochJ2000) / 365250.0;
+  }
+  std::span<double> outputs[]{longitudes, latitudes, radius_vectors_au};
+  for (int v = 0; v < static_cast<int>(Variable::kMax); v++) {
+    if (outputs[v].empty()) continue;
+    assert(outputs[v].size() == tts.size());
+    Variable variable{static_cast<Variable>(v)};
+    GetSeries(planet, variable)
+        .Compute(taus, outputs[v],
+                 accuracy == Accuracy::kFull ? nullptr
+                                             : &GetTruncation(planet, variable, accuracy));
+  }
+}
+
+inline void VSOP87::Compute(ThreadPool &pool, std::span<const double> tts,
+                            std::span<const VSOP87::Planet> planets, std::span<double> longitudes,
+                            std::span<double> latitudes, std::span<double> radius_vectors_au,
+                            VSOP87::Accuracy accuracy) {
+  // Epochs per task, enough to stream each table once per PeriodicSeries tile
+  constexpr std::size_t kTileSize{256};
+  struct Task {
+    const PeriodicSeries *series;
+    const PeriodicSeries::Truncation *truncation;
+    double term_count;
+    std::span<double> values;
+  };
+  std::vector<Task> tasks;
+  std::span<double> outputs[]{longitudes, latitudes, radius_vectors_au};
+  for (std::size_t k = 0; k < planets.size(); k++) {
+    for (int v = 0; v < static_cast<int>(Variable::kMax); v++) {
+      if (outputs[v].empty()) continue;
+      assert(outputs[v].size() == planets.size() * tts.size());
+      Variable variable{static_cast<Variable>(v)};
+      Task task{&GetSeries(planets[k], variable), nullptr, 0.0,
+                outputs[v].subspan(k * tts.size(), tts.size())};
+      if (accuracy != Accuracy::kFull) {
+        task.truncation = &GetTruncation(planets[k], variable, accuracy);
+      }
+      for (int degree = 0; degree < task.series->GetDegreeCount(); degree++) {
+        task.term_count += task.truncation ? task.truncation->term_counts[degree]
+                                           : task.series->GetTermCount(degree);
+      }
+      tasks.push_back(task);
+    }
+  }
+
+  std::size_t tile_count{(tts.size() + kTileSize - 1) / kTileSize};
+  auto get_tile_size{[&](std::size_t tile) {
+    return std::min(kTileSize, tts.size() - tile * kTileSize);
+  }};
+  pool.ParallelFor(
+      tasks.size() * tile_count,
+      [&](std::size_t begin, std::size_t end) {
+        double taus[kTileSize];
+        for (std::size_t item = begin; item < end; item++) {
+          const Task &task{tasks[item / tile_count]};
+          std::size_t first{item % tile_count * kTileSize};
+          std::size_t size{get_tile_size(item % tile_count)};
+          for (std::size_t i = 0; i < size; i++) {
+            taus[i] = (tts[first + i] - EpochJ2000) / 365250.0;
+          }
+          task.series->Compute(std::span<const double>{taus, size},
+                               task.values.subspan(first, size), task.truncation);
+        }
+      },
+      [&](std::size_t item) {
+        return tasks[item / tile_count].term_count * get_tile_size(item % tile_count);
+      });
+}
+
+inline void VSOP87::Compute(ThreadPool &pool, std::span<const double> tts, VSOP87::Planet planet,
+                            std::span<double> longitudes, std::span<double> latitudes,
+                            std::span<double> radius_vectors_au, VSOP87::Accuracy accuracy) {
+  Compute(pool, tts, std::span<const Planet>{&planet, 1}, longitudes, latitudes,
+          radius_vectors_au, accuracy);
+}
+
+inline void VSOP87::ComputeGrid(double tt_begin, double step_days, VSOP87::Planet planet,
+                                std::span<double> longitudes, std::span<double> latitudes,
+                                std::span<double> radius_vectors_au, double tolerance) {
+  std::span<double> outputs[]{longitudes, latitudes, radius_vectors_au};
+  for (int v = 0; v < static_cast<int>(Variable::kMax); v++) {
+    if (outputs[v].empty()) continue;
+    PeriodicTermNUFFT nufft{GetTable(planet, static_cast<Variable>(v)), tolerance};
+    nufft.Compute((tt_begin - EpochJ2000) / 365250.0, step_days / 365250.0, outputs[v]);
+  }
+}
+
+inline std::string VSOP87::GetSeriesName(VSOP87::Planet planet, VSOP87::Variable variable) {
+  static constexpr const char *kPlanetNames[]{
+      "Mercury", "Venus", "Earth", "Mars", "Jupiter", "Saturn", "Uranus", "Neptune",
+  };
+  static constexpr const char *kVariableNames[]{"L", "B", "R"};
+  return std::string{"VSOP87D/"} + kPlanetNames[static_cast<int>(planet)] + "/" +
+         kVariableNames[static_cast<int>(variable)];
+}
+
+inline bool VSOP87::SaveSeriesFile(const std::string &filename, VSOP87::Accuracy accuracy) {
+  std::vector<PeriodicSeriesFile::Source> sources;
+  for (int p = 0; p < static_cast<int>(Planet::kMax); p++) {
+    for (int v = 0; v < static_cast<int>(Variable::kMax); v++) {
+      Planet planet{static_cast<Planet>(p)};
+      Variable variable{static_cast<Variable>(v)};
+      sources.push_back(PeriodicSeriesFile::Source{
+          .name = GetSeriesName(planet, variable),
+          .table = &GetTable(planet, variable),
+          .epoch = EpochJ2000,
+          .unit_days = 365250.0,
+          .tolerance = kAccuracyTolerances[static_cast<int>(accuracy)],
+      });
+    }
+  }
+  return PeriodicSeriesFile::Save(filename, sources);
+}
+
+inline bool VSOP87::Compute(const PeriodicSeriesFile &file, double tt, VSOP87::Planet planet,
+                            double *p_longitude, double *p_latitude,
+                            double *p_radius_vector_au) {
+  double *outputs[]{p_longitude, p_latitude, p_radius_vector_au};
+  const PeriodicSeriesFile::Series *series[static_cast<int>(Variable::kMax)];
+  for (int v = 0; v < static_cast<int>(Variable::kMax); v++) {
+    series[v] = file.Find(GetSeriesName(planet, static_cast<Variable>(v)));
+    if (!series[v]) return false;
+  }
+  for (int v = 0; v < static_cast<int>(Variable::kMax); v++) {
+    if (outputs[v]) *outputs[v] = series[v]->Compute(series[v]->GetTime(tt));
+  }
+  return true;
+}
+
+inline const PeriodicSeries &VSOP87::GetSeries(VSOP87::Planet planet,
+                                               VSOP87::Variable variable) noexcept {
+  // Structure-of-arrays copies of the tables, built on first use
+  static const std::vector<PeriodicSeries> series{[] {
+    std::vector<PeriodicSeries> series;
+    for (int p = 0; p < static_cast<int>(Planet::kMax); p++) {
+      for (int v = 0; v < static_cast<int>(Variable::kMax); v++) {
+        series.emplace_back(GetTable(static_cast<Planet>(p), static_cast<Variable>(v)));
+      }
+    }
+    return series;
+  }()};
+  return series[static_cast<int>(planet) * static_cast<int>(Variable::kMax) +
+                static_cast<int>(variable)];
+}
+
+inline const MergedPeriodicSeries &VSOP87::GetMergedSeries(VSOP87::Planet planet,
+                                                           bool with_earth) noexcept {
+  // Merged tables of each planet, alone then with the Earth, built on first use
+  static const std::vector<MergedPeriodicSeries> series{[] {
+    std::vector<MergedPeriodicSeries> series;
+    for (bool with_earth : {false, true}) {
+      for (int p = 0; p < static_cast<int>(Planet::kMax); p++) {
+        Planet planet{static_cast<Planet>(p)};
+        if (with_earth) {
+          series.push_back(MergedPeriodicSeries{
+              &GetTable(planet, Variable::kLongitude),
+              &GetTable(planet, Variable::kLatitude),
+              &GetTable(planet, Variable::kRadiusVector),
+              &GetTable(Planet::kEarth, Variable::kLongitude),
+              &GetTable(Planet::kEarth, Variable::kLatitude),
+              &GetTable(Planet::kEarth, Variable::kRadiusVector),
+          });
+        } else {
+          series.push_back(MergedPeriodicSeries{
+              &GetTable(planet, Variable::kLongitude),
+              &GetTable(planet, Variable::kLatitude),
+              &GetTable(planet, Variable::kRadiusVector),
+          });
+        }
+      }
+    }
+    return series;
+  }()};
+  return series[(with_earth ? static_cast<int>(Planet::kMax) : 0) + static_cast<int>(planet)];
+}
+
+inline const SharedFrequencySeries &VSOP87::GetSharedFrequencySeries(
+    VSOP87::Planet planet) noexcept {
+  // Built on first use
+  static const std::vector<SharedFrequencySeries> series{[] {
+    std::vector<SharedFrequencySeries> series;
+    for (int p = 0; p < static_cast<int>(Planet::kMax); p++) {
+      series.emplace_back(GetSharedFrequencyTable(static_cast<Planet>(p)));
+    }
+    return series;
+  }()};
+  return series[static_cast<int>(planet)];
+}
+
+inline void VSOP87::ComputeWithEarth(double tt, VSOP87::Planet planet, double *p_longitude,
+                                     double *p_latitude, double *p_radius_vector_au,
+                                     double *p_earth_longitude, double *p_earth_latitude,
+                                     double *p_earth_radius_vector_au) noexcept {
+  double tau{(tt - EpochJ2000) / 365250.0};
+  double values[2 * static_cast<int>(Variable::kMax)];
+  if (planet == Planet::kEarth) {
+    GetMergedSeries(planet).Compute(tau, values);
+    std::copy(values, values + static_cast<int>(Variable::kMax),
+              values + static_cast<int>(Variable::kMax));
+  } else {
+    GetMergedSeries(planet, true).Compute(tau, values);
+  }
+  double *outputs[]{p_longitude,       p_latitude,       p_radius_vector_au,
+                    p_earth_longitude, p_earth_latitude, p_earth_radius_vector_au};
+  for (int k = 0; k < 2 * static_cast<int>(Variable::kMax); k++) {
+    if (outputs[k]) *outputs[k] = values[k];
+  }
+}
+
+inline const PeriodicSeries::Truncation &VSOP87::GetTruncation(
+    VSOP87::Planet planet, VSOP87::Variable variable, VSOP87::Accuracy accuracy) noexcept {
+  // Cutoffs of each accuracy target, computed on first use
+  static const std::vector<PeriodicSeries::Truncation> truncations{[] {
+    std::vector<PeriodicSeries::Truncation> truncations;
+    for (int p = 0; p < static_cast<int>(Planet::kMax); p++) {
+      for (int v = 0; v < static_cast<int>(Variable::kMax); v++) {
+        const PeriodicSeries &series{GetSeries(static_cast<Planet>(p), static_cast<Variable>(v))};
+        for (double tolerance : kAccuracyTolerances) {
+          truncations.push_back(series.ComputeTruncation(tolerance));
+        }
+      }
+    }
+    return truncations;
+  }()};
+  return truncations[(static_cast<int>(planet) * static_cast<int>(Variable::kMax) +
+                      static_cast<int>(variable)) *
+                         static_cast<int>(Accuracy::kMax) +
+                     static_cast<int>(accuracy)];
+}
+
+inline const PeriodicSeries::MixedPrecision &VSOP87::GetMixedPrecision(
+    VSOP87::Planet planet, VSOP87::Variable variable, VSOP87::Accuracy accuracy) noexcept {
+  // Cutoffs and single precision tails of each accuracy target, computed on
+  // first use
+  static const std::vector<PeriodicSeries::MixedPrecision> mixed_precisions{[] {
+    std::vector<PeriodicSeries::MixedPrecision> mixed_precisions;
+    for (int p = 0; p < static_cast<int>(Planet::kMax); p++) {
+      for (int v = 0; v < static_cast<int>(Variable::kMax); v++) {
+        const PeriodicSeries &series{GetSeries(static_cast<Planet>(p), static_cast<Variable>(v))};
+        for (double tolerance : kAccuracyTolerances) {
+          mixed_precisions.push_back(series.ComputeMixedPrecision(tolerance));
+        }
+      }
+    }
+    return mixed_precisions;
+  }()};
+  return mixed_precisions[(static_cast<int>(planet) * static_cast<int>(Variable::kMax) +
+                           static_cast<int>(variable)) *
+                              static_cast<int>(Accuracy::kMax) +
+                          static_cast<int>(accuracy)];
+}
+
+inline VSOP87::Stepper::Stepper(double tt_begin, double step_days, VSOP87::Planet planet,
+                                int reseed_interval)
+    : tt_begin_(tt_begin),
+      step_days_(step_days),
+      steppers_{
+          {GetTable(planet, Variable::kLongitude), (tt_begin - EpochJ2000) / 365250.0,
+           step_days / 365250.0, reseed_interval},
+          {GetTable(planet, Variable::kLatitude), (tt_begin - EpochJ2000) / 365250.0,
+           step_days / 365250.0, reseed_interval},
+          {GetTable(planet, Variable::kRadiusVector), (tt_begin - EpochJ2000) / 365250.0,
+           step_days / 365250.0, reseed_interval},
+      } {}
+
+// Same outputs as VSOP87::Compute() at GetTT()
+// - Accuracy: See PeriodicTermStepper
+inline void VSOP87::Stepper::Compute(double *p_longitude, double *p_latitude,
+                                     double *p_radius_vector_au) const noexcept {
+  double *outputs[]{p_longitude, p_latitude, p_radius_vector_au};
+  for (int v = 0; v < static_cast<int>(Variable::kMax); v++) {
+    if (outputs[v]) *outputs[v] = steppers_[v].Compute();
+  }
+}
+
+inline void VSOP87::Stepper::Step() noexcept {
+  step_++;
+  for (PeriodicTermStepper &stepper : steppers_) stepper.Step();
+}
+
+inline void VSOP87::ComputeRectangular(double tt, VSOP87::Planet planet, double *p_x, double *p_y,
+                                       double *p_z) noexcept {
+  double longitude, latitude, radius_vector_au;
+  Compute(tt, planet, &longitude, &latitude, &radius_vector_au);
+  if (p_x) *p_x = radius_vector_au * std::cos(latitude) * std::cos(longitude);
+  if (p_y) *p_y = radius_vector_au * std::cos(latitude) * std::sin(longitude);
+  if (p_z) *p_z = radius_vector_au * std::sin(latitude);
+}
+
+inline void VSOP87::ComputeRectangular(std::span<const double> tts, VSOP87::Planet planet,
+                                       std::span<double> xs, std::span<double> ys,
+                                       std::span<double> zs) {
+  std::span<double> outputs[]{xs, ys, zs};
+  for (const std::span<double> &output : outputs) {
+    assert(output.empty() || output.size() == tts.size());
+  }
+
+  // From the batched spherical series, converted with the vector sin/cos
+  using SIMD::kWidth;
+  std::vector<double> lons(tts.size()), lats(tts.size()), rs(tts.size());
+  Compute(tts, planet, lons, lats, rs);
+  for (std::size_t begin = 0; begin < tts.size(); begin += kWidth) {
+    std::size_t count{std::min<std::size_t>(kWidth, tts.size() - begin)};
+    SIMD::VecD lon{}, lat{}, r{};
+    for (std::size_t k = 0; k < count; k++) {
+      lon[k] = lons[begin + k];
+      lat[k] = lats[begin + k];
+      r[k] = rs[begin + k];
+    }
+    SIMD::VecD sin_lon, cos_lon, sin_lat, cos_lat;
+    SIMD::SinCos(lon, &sin_lon, &cos_lon);
+    SIMD::SinCos(lat, &sin_lat, &cos_lat);
+    SIMD::VecD xyz[]{r * cos_lat * cos_lon, r * cos_lat * sin_lon, r * sin_lat};
+    for (int v = 0; v < 3; v++) {
+      if (outputs[v].empty()) continue;
+      for (std::size_t k = 0; k < count; k++) outputs[v][begin + k] = xyz[v][k];
+    }
+  }
+}
+
 constexpr void VSOP87::VSOP87DFrameToFK5(double tt, double *p_longitude,
                                          double *p_latitude) noexcept {
   // Conversion: Mean *dynamical* equinox and ecliptic of the date to FK5
@@ -0,0 +1,18 @@
+#include "vsop87.h"
+
+namespace PA {
+
+namespace {
+
+// About 40000 lines of tables: Kept out of vsop87.h, so that they are
+// compiled once rather than in every translation unit using VSOP87
+#include "vsop87_frequencies_internal.dat"
+
+}  // namespace
+
+const SharedFrequencyTable &VSOP87::GetSharedFrequencyTable(
+    VSOP87::Planet planet) noexcept {
+  return vsop87_frequency_tables[static_cast<int>(planet)];
+}
+
+}  // namespace PA
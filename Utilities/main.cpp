@@ -1,7 +1,15 @@
+#include <algorithm>
 #include <cassert>
+#include <cctype>
+#include <cmath>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <map>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #define DIRECTORY_VSOP87 (std::string(getenv("HOME")) + "/utils/VSOP87/")
 
@@ -12,9 +20,18 @@
   (std::string(getenv("HOME")) + \
    "/utils/Nutation/Nutation_IAU_2000B_Raw_Data.txt")
 
+// SOFA nut00a.c (IAU 2000A), converted by process_nut00a() to the layout of
+// the IERS Conventions tables 5.3a (longitude) and 5.3b (obliquity); the
+// shipped iau2000a_internal.dat is generated from these
+#define FILENAME_SOFA_NUT00A \
+  (std::string(getenv("HOME")) + "/utils/Nutation/nut00a.c")
+#define FILENAME_IAU2000A_PSI "/tmp/tab5.3a.txt"
+#define FILENAME_IAU2000A_EPS "/tmp/tab5.3b.txt"
+
 #define DIRECTORY_ELPMPP02 \
   (std::string(getenv("HOME")) + "/utils/2_lunar_solutions/2_elpmpp02/")
 
+// VSOP87D (spherical, heliocentric, ecliptic and equinox of the date)
 bool process_vsop87() {
   std::cout << "Processing VSOP87 files..." << std::endl;
 
@@ -97,6 +114,139 @@ bool process_vsop87() {
   return true;
 }
 
+// VSOP87D with the frequencies shared by the L, B and R series of a planet
+// (see FrequencyTerm in PracticalAstronomy/utils.h)
+// - For each planet: its distinct frequencies c, then for each variable and
+//   degree the terms { frequency index, p, q }, where
+//   a cos(b + c t) = p cos(c t) + q sin(c t), i.e. p = a cos b, q = -a sin b;
+//   the terms of a degree with the same frequency are summed
+// - An index vsop87_frequency_tables[planet] follows them
+// - Included by PracticalAstronomy/vsop87_frequencies.cpp only
+bool process_vsop87_frequencies() {
+  std::cout << "Processing VSOP87 frequencies..." << std::endl;
+
+  static const std::string planet_names[]{
+      "mercury", "venus",  "earth",  "mars",
+      "jupiter", "saturn", "uranus", "neptune",
+  };
+  static constexpr char variable_char[]{'l', 'b', 'r'};
+
+  std::ofstream outfile("/tmp/vsop87_frequencies_internal.dat");
+  outfile << std::setprecision(17);
+
+  std::vector<std::size_t> frequency_counts;
+  for (const std::string &planet_name : planet_names) {
+    std::string filename{DIRECTORY_VSOP87};
+    filename += "VSOP87D.";
+    filename += planet_name.substr(0, 3);
+    std::ifstream infile(filename);
+    if (!infile) {
+      std::cout << "ERROR opening " << filename << "!" << std::endl;
+      return false;
+    }
+
+    struct Term {
+      int frequency;
+      double p;
+      double q;
+    };
+    std::vector<double> frequencies;
+    std::map<double, int> frequency_indices;
+    std::vector<Term> terms[3][7];
+    int degree_counts[3]{0, 0, 0};
+
+    std::string line;
+    while (!std::getline(infile, line).eof()) {
+      // Header record
+      int variable{std::stoi(line.substr(41, 1)) - 1};
+      int degree{std::stoi(line.substr(59, 1))};
+      int table_size{std::stoi(line.substr(60, 7))};
+      degree_counts[variable] = std::max(degree_counts[variable], degree + 1);
+
+      // Term Records
+      std::map<int, std::size_t> term_indices;
+      for (int rec_no = 1; rec_no <= table_size; rec_no++) {
+        std::getline(infile, line);
+        double a{std::stod(line.substr(79, 18))};
+        double b{std::stod(line.substr(97, 14))};
+        double c{std::stod(line.substr(111, 20))};
+        auto frequency{frequency_indices.try_emplace(
+            c, static_cast<int>(frequencies.size()))};
+        if (frequency.second) frequencies.push_back(c);
+        std::vector<Term> &degree_terms{terms[variable][degree]};
+        auto term{term_indices.try_emplace(frequency.first->second,
+                                           degree_terms.size())};
+        if (term.second) {
+          degree_terms.push_back(Term{frequency.first->second, 0.0, 0.0});
+        }
+        degree_terms[term.first->second].p += a * std::cos(b);
+        degree_terms[term.first->second].q -= a * std::sin(b);
+      }
+    }
+
+    outfile << "static constexpr double " << planet_name << "_frequencies["
+            << frequencies.size() << "]{" << std::endl;
+    for (double c : frequencies) outfile << "    " << c << "," << std::endl;
+    outfile << "};" << std::endl;
+    frequency_counts.push_back(frequencies.size());
+
+    for (int v = 0; v < 3; v++) {
+      std::string prefix{planet_name + '_' + variable_char[v]};
+
+      for (int degree = 0; degree < degree_counts[v]; degree++) {
+        outfile << "static constexpr struct FrequencyTerm " << prefix << degree
+                << "_frequency_terms[" << terms[v][degree].size() << "]{"
+                << std::endl;
+        for (const Term &term : terms[v][degree]) {
+          outfile << "    { " << term.frequency << ", " << term.p << ", "
+                  << term.q << " }," << std::endl;
+        }
+        outfile << "};" << std::endl;
+      }
+
+      outfile << "static constexpr struct FrequencyTermTableDegree ";
+      outfile << prefix << "_frequency_table_degrees[]{" << std::endl;
+      for (int degree = 0; degree < degree_counts[v]; degree++) {
+        outfile << "    {" << prefix << degree << "_frequency_terms, "
+                << terms[v][degree].size() << "}," << std::endl;
+      }
+      outfile << "};" << std::endl;
+
+      outfile << "static constexpr struct FrequencyTermTable ";
+      outfile << prefix << "_frequency_table ";
+      outfile << '{';
+      outfile << ".degrees = " << prefix << "_frequency_table_degrees, ";
+      outfile << ".size = " << degree_counts[v] << " ";
+      outfile << "};" << std::endl;
+    }
+
+    outfile << "static constexpr struct FrequencyTermTable " << planet_name
+            << "_frequency_term_tables[]{";
+    for (int v = 0; v < 3; v++) {
+      outfile << planet_name << '_' << variable_char[v] << "_frequency_table"
+              << (v < 2 ? ", " : "");
+    }
+    outfile << "};" << std::endl;
+
+    infile.close();
+  }
+
+  outfile << "static constexpr struct SharedFrequencyTable "
+             "vsop87_frequency_tables[]{"
+          << std::endl;
+  for (std::size_t planet = 0; planet < std::size(planet_names); planet++) {
+    const std::string &planet_name{planet_names[planet]};
+    outfile << "    {" << planet_name << "_frequencies, "
+            << frequency_counts[planet] << ", " << planet_name
+            << "_frequency_term_tables, 3}," << std::endl;
+  }
+  outfile << "};" << std::endl;
+
+  outfile.close();
+
+  return true;
+}
+
 bool process_iau1980() {
   std::cout << "Processing IAU1980 file..." << std::endl;
 
@@ -181,6 +331,253 @@ bool process_iau2000b() {
   return true;
 }
 
+// Numbers of the initializer "name[] = { ... };" of a C source, without its
+// comments
+bool read_c_array(const std::string &source, const std::string &name,
+                  std::vector<double> *p_values) {
+  std::string code;
+  for (std::size_t pos{0}; pos < source.size();) {
+    std::size_t begin{source.find("/*", pos)};
+    code += source.substr(pos, begin - pos);
+    if (begin == std::string::npos) break;
+    std::size_t end{source.find("*/", begin + 2)};
+    if (end == std::string::npos) return false;
+    pos = end + 2;
+  }
+
+  std::size_t begin{code.find(name + "[] = {")};
+  if (begin == std::string::npos) return false;
+  begin += name.size() + 5;
+  std::size_t end{code.find("};", begin)};
+  if (end == std::string::npos) return false;
+  std::string initializer{code.substr(begin, end - begin)};
+  std::replace_if(
+      initializer.begin(), initializer.end(),
+      [](char c) { return c == '{' || c == '}' || c == ','; }, ' ');
+  std::istringstream iss(initializer);
+  p_values->assign(std::istream_iterator<double>(iss),
+                   std::istream_iterator<double>());
+  return iss.eof();
+}
+
+// SOFA nut00a.c, converted to the layout of the IERS tables 5.3a and 5.3b (see
+// read_iau2000a())
+// - xls: The luni-solar terms, "l l' F D Om  sp spt cp  ce cet se"
+// - xpl: The planetary terms, "l F D Om L_Me L_Ve L_E L_Ma L_J L_Sa L_U L_Ne
+//   p_A  sp cp  se ce", without l' and without terms in t
+// - Amplitudes in 0.1 micro-arcseconds, all integers; the terms that are
+//   zero at that precision are left out
+bool process_nut00a() {
+  std::cout << "Processing SOFA nut00a file..." << std::endl;
+
+  std::ifstream infile(FILENAME_SOFA_NUT00A);
+  if (!infile) {
+    std::cout << "ERROR opening " << FILENAME_SOFA_NUT00A << "!" << std::endl;
+    return false;
+  }
+  std::stringstream source;
+  source << infile.rdbuf();
+  infile.close();
+
+  std::vector<double> xls, xpl;
+  if (!read_c_array(source.str(), "xls", &xls) || xls.size() % 11 != 0 ||
+      !read_c_array(source.str(), "xpl", &xpl) || xpl.size() % 17 != 0) {
+    std::cout << "ERROR no xls and xpl tables in " << FILENAME_SOFA_NUT00A
+              << "!" << std::endl;
+    return false;
+  }
+
+  // Terms of each power of t (j): multipliers, then the coefficients of sin
+  // and of cos
+  struct Term {
+    int multipliers[14];
+    double amplitudes[2];
+  };
+  std::vector<Term> psi[2], eps[2];
+  for (std::size_t i = 0; i < xls.size(); i += 11) {
+    Term term{};
+    for (int a = 0; a < 5; a++) term.multipliers[a] = xls[i + a];
+    const double *c{&xls[i + 5]};
+    if (std::all_of(c, c + 6, [](double a) { return a == 0.0; })) continue;
+    psi[0].push_back(term);
+    psi[0].back().amplitudes[0] = c[0];
+    psi[0].back().amplitudes[1] = c[2];
+    eps[0].push_back(term);
+    eps[0].back().amplitudes[0] = c[5];
+    eps[0].back().amplitudes[1] = c[3];
+    if (c[1] != 0.0) {
+      psi[1].push_back(term);
+      psi[1].back().amplitudes[0] = c[1];
+    }
+    if (c[4] != 0.0) {
+      eps[1].push_back(term);
+      eps[1].back().amplitudes[1] = c[4];
+    }
+  }
+  for (std::size_t i = 0; i < xpl.size(); i += 17) {
+    Term term{};
+    term.multipliers[0] = xpl[i];
+    for (int a = 1; a < 13; a++) term.multipliers[a + 1] = xpl[i + a];
+    const double *c{&xpl[i + 13]};
+    if (std::all_of(c, c + 4, [](double a) { return a == 0.0; })) continue;
+    psi[0].push_back(term);
+    psi[0].back().amplitudes[0] = c[0];
+    psi[0].back().amplitudes[1] = c[1];
+    eps[0].push_back(term);
+    eps[0].back().amplitudes[0] = c[2];
+    eps[0].back().amplitudes[1] = c[3];
+  }
+
+  const std::pair<const char *, const std::vector<Term> *> outputs[]{
+      {FILENAME_IAU2000A_PSI, psi}, {FILENAME_IAU2000A_EPS, eps}};
+  for (const auto &[filename, terms] : outputs) {
+    std::ofstream outfile(filename);
+    outfile << std::fixed << std::setprecision(1);
+    for (int j = 0; j < 2; j++) {
+      outfile << "j = " << j << "  Number of terms = " << terms[j].size()
+              << std::endl;
+      outfile << "    i         A_i       A''_i    l  l'   F   D  Om  Me  Ve   E"
+                 "  Ma   J  Sa   U  Ne  pA"
+              << std::endl;
+      int i{1};
+      for (const Term &term : terms[j]) {
+        outfile << std::setw(5) << i++;
+        for (double amplitude : term.amplitudes) {
+          assert(amplitude == std::round(amplitude));
+          outfile << ' ' << std::setw(11) << amplitude / 10.0;
+        }
+        for (int m : term.multipliers) outfile << ' ' << std::setw(3) << m;
+        outfile << std::endl;
+      }
+    }
+    outfile.close();
+  }
+
+  return true;
+}
+
+// IAU 2000A (MHB2000): Luni-solar and planetary terms, in one table
+// - Records "i  A  A''  l l' F D Om L_Me L_Ve L_E L_Ma L_J L_Sa L_U L_Ne p_A"
+//   (micro-arcseconds), in blocks "j = 0" and "j = 1" (the terms in t)
+// - The terms of both files are merged by multipliers, then sorted by
+//   decreasing amplitude for the truncations (see
+//   EarthNutation::GetTruncation()); the output is included in the class
+//   EarthNutation
+bool read_iau2000a(const std::string &filename,
+                   std::map<std::vector<int>, std::vector<double>> *p_terms,
+                   int offset) {
+  std::ifstream infile(filename);
+  if (!infile) {
+    std::cout << "ERROR opening " << filename << "!" << std::endl;
+    return false;
+  }
+
+  // Amplitudes of the two columns, of j = 0 then of j = 1
+  std::map<std::vector<int>, std::vector<double>> amplitudes;
+  int j{-1};
+  std::string line;
+  while (std::getline(infile, line)) {
+    std::size_t pos{line.find("j =")};
+    if (pos != std::string::npos) {
+      j = std::stoi(line.substr(pos + 3));
+      if (j < 0 || j > 1) {
+        std::cout << "ERROR unexpected power of t " << j << "!" << std::endl;
+        return false;
+      }
+      continue;
+    }
+    std::istringstream iss(line);
+    std::vector<std::string> fields{std::istream_iterator<std::string>(iss),
+                                    std::istream_iterator<std::string>()};
+    if (j < 0 || fields.size() != 17 ||
+        !std::isdigit(static_cast<unsigned char>(fields[0][0]))) {
+      continue;
+    }
+    std::vector<int> multipliers;
+    for (int i = 3; i < 17; i++) multipliers.push_back(std::stoi(fields[i]));
+    std::vector<double> &a{amplitudes[multipliers]};
+    a.resize(4);
+    a[2 * j] += std::stod(fields[1]);
+    a[2 * j + 1] += std::stod(fields[2]);
+  }
+  infile.close();
+
+  // Column of sin for the longitude, of cos for the obliquity: The one of the
+  // largest term (Omega)
+  const std::vector<int> omega{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+  if (amplitudes.find(omega) == amplitudes.end()) {
+    std::cout << "ERROR no Omega term in " << filename << "!" << std::endl;
+    return false;
+  }
+  int major{std::fabs(amplitudes[omega][0]) > std::fabs(amplitudes[omega][1])
+                ? 0
+                : 1};
+
+  // Coefficients: psi_sin, psi_t_sin, psi_cos, psi_t_cos, then eps_cos,
+  // eps_t_cos, eps_sin, eps_t_sin
+  for (const auto &[multipliers, a] : amplitudes) {
+    std::vector<double> &coefficients{(*p_terms)[multipliers]};
+    coefficients.resize(8);
+    for (int k = 0; k < 2; k++) {
+      coefficients[offset + k] += a[2 * k + major];
+      coefficients[offset + 2 + k] += a[2 * k + 1 - major];
+    }
+  }
+  return true;
+}
+
+bool process_iau2000a() {
+  std::cout << "Processing IAU2000A files..." << std::endl;
+
+  std::map<std::vector<int>, std::vector<double>> terms;
+  if (!read_iau2000a(FILENAME_IAU2000A_PSI, &terms, 0) ||
+      !read_iau2000a(FILENAME_IAU2000A_EPS, &terms, 4)) {
+    return false;
+  }
+
+  std::vector<std::pair<std::vector<int>, std::vector<double>>> sorted(
+      terms.begin(), terms.end());
+  auto amplitude{[](const std::vector<double> &coefficients) {
+    double sums[2]{0.0, 0.0};
+    for (int k = 0; k < 8; k++) sums[k / 4] += std::fabs(coefficients[k]);
+    return std::max(sums[0], sums[1]);
+  }};
+  std::stable_sort(sorted.begin(), sorted.end(),
+                   [&amplitude](const auto &a, const auto &b) {
+                     return amplitude(a.second) > amplitude(b.second);
+                   });
+  int max_multiple{0};
+  for (const auto &term : sorted) {
+    for (int m : term.first) max_multiple = std::max(max_multiple, std::abs(m));
+  }
+
+  std::ofstream outfile("/tmp/iau2000a_internal.dat");
+  outfile << "static constexpr int kMaxMultipleIAU2000A{" << max_multiple
+          << "};" << std::endl;
+  outfile << "static constexpr Terms<" << sorted.size()
+          << ", kArgumentCountIAU2000A> kTermsIAU2000A{" << std::endl;
+  outfile << "    .divisor = 1000000.0," << std::endl;
+  outfile << "    .multipliers = {" << std::endl;
+  for (int a = 0; a < 14; a++) {
+    outfile << "        {";
+    for (const auto &term : sorted) outfile << term.first[a] << ", ";
+    outfile << "}," << std::endl;
+  }
+  outfile << "    }," << std::endl;
+  static const char *names[]{"psi_sin", "psi_t_sin", "psi_cos", "psi_t_cos",
+                             "eps_cos", "eps_t_cos", "eps_sin", "eps_t_sin"};
+  outfile << std::fixed << std::setprecision(2);
+  for (int k = 0; k < 8; k++) {
+    outfile << "    ." << names[k] << " = {";
+    for (const auto &term : sorted) outfile << term.second[k] << "_arcsec, ";
+    outfile << "}," << std::endl;
+  }
+  outfile << "};" << std::endl;
+  outfile.close();
+
+  return true;
+}
+
 bool process_elpmpp02() {
   std::cout << "Processing ELPMPP02 file..." << std::endl;
 
@@ -305,8 +702,11 @@ bool process_elpmpp02() {
 
 int main(void) {
   process_vsop87();
+  process_vsop87_frequencies();
   process_iau1980();
   process_iau2000b();
+  process_nut00a();
+  process_iau2000a();
   process_elpmpp02();
   return 0;
 }